@@ -330,6 +330,15 @@ using JavaScriptCompileHintsMagicEnabledCallback =
 // --- Callback for checking if WebAssembly JSPI is enabled ---
 using WasmJSPIEnabledCallback = bool (*)(Local<Context> context);
 
+/**
+ * Called when a regexp execution exceeds its backtrack budget and is re-run on
+ * the linear-time engine. |source| and |flags| (a v8::RegExp::Flags bit set)
+ * identify the regexp. The callback must not execute JavaScript.
+ */
+using RegExpBacktrackBudgetExceededCallback = void (*)(Isolate* isolate,
+                                                       Local<String> source,
+                                                       int flags);
+
 /**
  * Import phases in import requests.
  */
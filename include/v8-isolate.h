@@ -1487,6 +1487,24 @@ class V8_EXPORT Isolate {
    */
   void SetStackLimit(uintptr_t stack_limit);
 
+  /**
+   * Sets a backtrack budget for all regexps of this Isolate that are compiled
+   * afterwards. An execution that exceeds the budget is transparently re-run
+   * on the linear-time regexp engine, so results don't change. Patterns which
+   * the linear-time engine doesn't support (e.g. those with backreferences or
+   * lookarounds) are not subject to the budget; use
+   * RegExp::NewWithBacktrackLimit to bound those. A budget of 0 disables the
+   * Isolate-wide budget.
+   */
+  void SetRegExpBacktrackBudget(uint32_t budget);
+
+  /**
+   * Registers a callback that is invoked whenever a regexp execution exceeds
+   * its backtrack budget and is re-run on the linear-time engine.
+   */
+  void SetRegExpBacktrackBudgetExceededCallback(
+      RegExpBacktrackBudgetExceededCallback callback);
+
   /**
    * Returns a memory range that can potentially contain jitted code. Code for
    * V8's 'builtins' will not be in this range if embedded builtins is enabled.
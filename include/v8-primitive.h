@@ -203,6 +203,33 @@ class V8_EXPORT String : public Name {
   int WriteUtf8(Isolate* isolate, char* buffer, int length = -1,
                 int* nchars_ref = nullptr, int options = NO_OPTIONS) const;
 
+  /**
+   * Called by WriteUtf8WithResize if the string doesn't fit into |buffer|.
+   * Has to return a buffer of at least |size| bytes that starts with the
+   * first |used| bytes of |buffer|, e.g. by calling realloc, or nullptr to
+   * stop writing. Must not call into V8.
+   */
+  using Utf8ResizeCallback = char* (*)(char* buffer, int used, int size,
+                                       void* data);
+
+  /**
+   * Writes the UTF-8 encoding of the string into |buffer|, which has room for
+   * |capacity| bytes. If the encoding doesn't fit, |resize| is called once
+   * with the exact number of bytes needed, and the rest of the string is
+   * written to the buffer it returns. Unlike Utf8Length followed by
+   * WriteUtf8, this reads strings that fit only once.
+   *
+   * \param data Passed to |resize|.
+   * \param options NO_NULL_TERMINATION and REPLACE_INVALID_UTF8 are
+   *    supported.
+   * \return The number of bytes written including the null terminator (if
+   *    written). If |resize| returns nullptr, the number of bytes written to
+   *    |buffer|, which is not null-terminated.
+   */
+  int WriteUtf8WithResize(Isolate* isolate, char* buffer, int capacity,
+                          Utf8ResizeCallback resize, void* data,
+                          int options = NO_OPTIONS) const;
+
   /**
    * A zero length string.
    */
@@ -59,7 +59,9 @@ class V8_EXPORT RegExp : public Object {
   /**
    * Like New, but additionally specifies a backtrack limit. If the number of
    * backtracks done in one Exec call hits the limit, a match failure is
-   * immediately returned.
+   * immediately returned. If an Isolate-wide budget is set (see
+   * Isolate::SetRegExpBacktrackBudget) and the pattern is supported by the
+   * linear-time engine, the execution is re-run on that engine instead.
    */
   static V8_WARN_UNUSED_RESULT MaybeLocal<RegExp> NewWithBacktrackLimit(
       Local<Context> context, Local<String> pattern, Flags flags,
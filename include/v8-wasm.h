@@ -53,6 +53,24 @@ class V8_EXPORT CompiledWasmModule {
    */
   MemorySpan<const uint8_t> GetWireBytesRef();
 
+  /**
+   * Export the profile collected for this module so far: which functions were
+   * executed and optimized, and the call target feedback used for inlining.
+   * The profile is specific to the wire bytes of this module.
+   */
+  OwnedBuffer GetProfile();
+
+  /**
+   * Import a profile previously returned by {GetProfile} for a module with the
+   * same wire bytes. The recorded call target feedback is installed, and the
+   * functions that were optimized in the profiling run get compiled with the
+   * optimizing tier in the background, using that feedback for inlining.
+   * This should be called right after compilation. Returns false if the
+   * profile is invalid or does not match this module, in which case it is
+   * ignored.
+   */
+  bool ApplyProfile(MemorySpan<const uint8_t> profile);
+
   const std::string& source_url() const { return source_url_; }
 
  private:
@@ -187,6 +205,32 @@ class V8_EXPORT WasmStreaming final {
    */
   void SetUrl(const char* url, size_t length);
 
+  /**
+   * Progress of streaming compilation, as returned by {GetProgress}.
+   */
+  struct Progress {
+    /** Number of module bytes decoded so far. */
+    size_t received_bytes = 0;
+    /**
+     * Number of functions in the code section, or 0 if the code section was
+     * not reached yet.
+     */
+    int total_functions = 0;
+    /** Number of function bodies received so far. */
+    int received_functions = 0;
+    /**
+     * Number of functions for which baseline compilation finished. Functions
+     * which are compiled lazily are not included.
+     */
+    int compiled_functions = 0;
+  };
+
+  /**
+   * Returns the current progress of streaming compilation. Compilation
+   * progress is only updated until {Finish} or {Abort} is called.
+   */
+  Progress GetProgress();
+
   /**
    * Unpacks a {WasmStreaming} object wrapped in a  {Managed} for the embedder.
    * Since the embedder is on the other side of the API, it cannot unpack the
@@ -132,6 +132,7 @@
 #include "src/snapshot/snapshot.h"
 #include "src/strings/char-predicates-inl.h"
 #include "src/strings/string-hasher.h"
+#include "src/strings/unicode-decoder.h"
 #include "src/strings/unicode-inl.h"
 #include "src/tracing/trace-event.h"
 #include "src/utils/detachable-vector.h"
@@ -141,6 +142,7 @@
 #if V8_ENABLE_WEBASSEMBLY
 #include "src/debug/debug-wasm-objects.h"
 #include "src/trap-handler/trap-handler.h"
+#include "src/wasm/pgo.h"
 #include "src/wasm/streaming-decoder.h"
 #include "src/wasm/value-type.h"
 #include "src/wasm/wasm-engine.h"
@@ -5892,6 +5894,36 @@ bool String::ContainsOnlyOneByte() const {
   return helper.Check(*str);
 }
 
+namespace {
+// Returns the number of bytes in the UTF-8 encoding of `chars`. The counting
+// loops have no data-dependent branches, so that the compiler can vectorize
+// them.
+int Utf8EncodedLength(base::Vector<const uint8_t> chars) {
+  int utf8_length = chars.length();
+  for (uint8_t c : chars) utf8_length += c >> 7;
+  return utf8_length;
+}
+
+int Utf8EncodedLength(base::Vector<const uint16_t> chars) {
+  // The ASCII prefix can't end in a lead surrogate.
+  int ascii_length = i::NonAsciiStart(chars.begin(), chars.length());
+  chars = chars.SubVector(ascii_length, chars.length());
+  // Code units above U+007F take two bytes, and above U+07FF three bytes.
+  // Surrogates are no exception, unless they form a pair, which takes four
+  // bytes instead of six.
+  if (chars.empty()) return ascii_length;
+  int utf8_length = ascii_length + chars.length() + (chars[0] > 0x7F) +
+                    (chars[0] > 0x7FF);
+  for (size_t i = 1; i < chars.size(); i++) {
+    uint16_t c = chars[i];
+    utf8_length += (c > 0x7F) + (c > 0x7FF) -
+                   2 * (unibrow::Utf16::IsLeadSurrogate(chars[i - 1]) &
+                        unibrow::Utf16::IsTrailSurrogate(c));
+  }
+  return utf8_length;
+}
+}  // anonymous namespace
+
 int String::Utf8Length(Isolate* v8_isolate) const {
   auto str = Utils::OpenHandle(this);
   str = i::String::Flatten(reinterpret_cast<i::Isolate*>(v8_isolate), str);
@@ -5900,20 +5932,8 @@ int String::Utf8Length(Isolate* v8_isolate) const {
   i::DisallowGarbageCollection no_gc;
   i::String::FlatContent flat = str->GetFlatContent(no_gc);
   DCHECK(flat.IsFlat());
-  int utf8_length = 0;
-  if (flat.IsOneByte()) {
-    for (uint8_t c : flat.ToOneByteVector()) {
-      utf8_length += c >> 7;
-    }
-    utf8_length += length;
-  } else {
-    int last_character = unibrow::Utf16::kNoPreviousCharacter;
-    for (uint16_t c : flat.ToUC16Vector()) {
-      utf8_length += unibrow::Utf8::Length(c, last_character);
-      last_character = c;
-    }
-  }
-  return utf8_length;
+  if (flat.IsOneByte()) return Utf8EncodedLength(flat.ToOneByteVector());
+  return Utf8EncodedLength(flat.ToUC16Vector());
 }
 
 namespace {
@@ -5952,33 +5972,46 @@ static int WriteUtf8Impl(base::Vector<const Char> string, char* write_start,
       if (writable_length <= 0) break;
       up_to = std::min(up_to, read_index + writable_length);
     }
-    // Write the characters to the stream.
-    if (sizeof(Char) == 1) {
-      // Simply memcpy if we only have ASCII characters.
-      uint8_t char_mask = 0;
-      for (int i = read_index; i < up_to; i++) char_mask |= read_start[i];
-      if ((char_mask & 0x80) == 0) {
-        int copy_length = up_to - read_index;
-        memcpy(current_write, read_start + read_index, copy_length);
-        current_write += copy_length;
-        read_index = up_to;
+    // Write the characters to the stream. Runs of ASCII characters are found
+    // with i::NonAsciiStart, which scans long strings in SIMD blocks, and are
+    // copied in bulk.
+    while (read_index < up_to) {
+      int ascii_length =
+          i::NonAsciiStart(read_start + read_index, up_to - read_index);
+      if constexpr (sizeof(Char) == 1) {
+        memcpy(current_write, read_start + read_index, ascii_length);
       } else {
-        for (; read_index < up_to; read_index++) {
+        i::CopyChars(reinterpret_cast<uint8_t*>(current_write),
+                     read_start + read_index, ascii_length);
+      }
+      current_write += ascii_length;
+      read_index += ascii_length;
+      if (ascii_length > 0) prev_char = read_start[read_index - 1];
+      if (read_index == up_to) break;
+      // Encode characters one by one until a run of ASCII characters makes it
+      // worth scanning again. The one-byte scan may stop at the start of the
+      // word containing the non-ASCII character, so always encode at least
+      // one character.
+      static const int kMinAsciiRunLength = 8;
+      int ascii_run_length = 0;
+      do {
+        uint16_t character = read_start[read_index++];
+        if constexpr (sizeof(Char) == 1) {
           current_write += unibrow::Utf8::EncodeOneByte(
-              current_write, static_cast<uint8_t>(read_start[read_index]));
-          DCHECK(write_capacity == -1 ||
-                 (current_write - write_start) <= write_capacity);
+              current_write, static_cast<uint8_t>(character));
+        } else {
+          current_write += unibrow::Utf8::Encode(
+              current_write, character, prev_char, replace_invalid_utf8);
+          prev_char = character;
         }
-      }
-    } else {
-      for (; read_index < up_to; read_index++) {
-        uint16_t character = read_start[read_index];
-        current_write += unibrow::Utf8::Encode(current_write, character,
-                                               prev_char, replace_invalid_utf8);
-        prev_char = character;
-        DCHECK(write_capacity == -1 ||
-               (current_write - write_start) <= write_capacity);
-      }
+        if (character > unibrow::Utf8::kMaxOneByteChar) {
+          ascii_run_length = 0;
+        } else if (++ascii_run_length == kMinAsciiRunLength) {
+          break;
+        }
+      } while (read_index < up_to);
+      DCHECK(write_capacity == -1 ||
+             (current_write - write_start) <= write_capacity);
     }
   }
   if (read_index < read_length) {
@@ -6042,6 +6075,42 @@ static int WriteUtf8Impl(base::Vector<const Char> string, char* write_start,
   }
   return static_cast<int>(current_write - write_start);
 }
+
+// Writes as much of the string as fits into the buffer, and the rest into the
+// buffer returned by `resize`, which is sized from the UTF-8 length of the
+// remaining characters only.
+template <typename Char>
+int WriteUtf8WithResizeImpl(base::Vector<const Char> string, char* buffer,
+                            int capacity, String::Utf8ResizeCallback resize,
+                            void* data, int options) {
+  bool write_null = !(options & String::NO_NULL_TERMINATION);
+  int null_length = write_null ? 1 : 0;
+  options |= String::NO_NULL_TERMINATION;
+  int chars_read = 0;
+  int written =
+      WriteUtf8Impl<Char>(string, buffer, capacity, options, &chars_read);
+  if (chars_read == string.length() && written + null_length <= capacity) {
+    if (write_null) buffer[written++] = '\0';
+    return written;
+  }
+  // Without REPLACE_INVALID_UTF8, the lead surrogate of a pair that doesn't
+  // fit is written on its own. Write the pair to the new buffer instead.
+  if (chars_read > 0 && chars_read < string.length() &&
+      unibrow::Utf16::IsSurrogatePair(string[chars_read - 1],
+                                      string[chars_read])) {
+    chars_read--;
+    written -= unibrow::Utf8::kSizeOfUnmatchedSurrogate;
+  }
+  base::Vector<const Char> rest = string.SubVector(chars_read, string.length());
+  int size = written + Utf8EncodedLength(rest) + null_length;
+  char* new_buffer = resize(buffer, written, size, data);
+  if (new_buffer == nullptr) return written;
+  written += WriteUtf8Impl<Char>(rest, new_buffer + written, -1, options,
+                                 nullptr);
+  if (write_null) new_buffer[written++] = '\0';
+  DCHECK_EQ(size, written);
+  return written;
+}
 }  // anonymous namespace
 
 int String::WriteUtf8(Isolate* v8_isolate, char* buffer, int capacity,
@@ -6062,6 +6131,27 @@ int String::WriteUtf8(Isolate* v8_isolate, char* buffer, int capacity,
   }
 }
 
+int String::WriteUtf8WithResize(Isolate* v8_isolate, char* buffer,
+                                int capacity, Utf8ResizeCallback resize,
+                                void* data, int options) const {
+  auto str = Utils::OpenHandle(this);
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  Utils::ApiCheck(capacity >= 0, "v8::String::WriteUtf8WithResize",
+                  "Capacity must not be negative");
+  API_RCS_SCOPE(i_isolate, String, WriteUtf8WithResize);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  str = i::String::Flatten(i_isolate, str);
+  i::DisallowGarbageCollection no_gc;
+  i::String::FlatContent content = str->GetFlatContent(no_gc);
+  if (content.IsOneByte()) {
+    return WriteUtf8WithResizeImpl<uint8_t>(content.ToOneByteVector(), buffer,
+                                            capacity, resize, data, options);
+  } else {
+    return WriteUtf8WithResizeImpl<uint16_t>(content.ToUC16Vector(), buffer,
+                                             capacity, resize, data, options);
+  }
+}
+
 template <typename CharType>
 static inline int WriteHelper(i::Isolate* i_isolate, const String* string,
                               CharType* buffer, int start, int length,
@@ -8880,6 +8970,34 @@ MemorySpan<const uint8_t> CompiledWasmModule::GetWireBytesRef() {
 #endif  // V8_ENABLE_WEBASSEMBLY
 }
 
+OwnedBuffer CompiledWasmModule::GetProfile() {
+#if V8_ENABLE_WEBASSEMBLY
+  TRACE_EVENT0("v8.wasm", "wasm.GetProfile");
+  base::OwnedVector<uint8_t> profile_data = i::wasm::GetProfileData(
+      native_module_->module(), native_module_->wire_bytes(),
+      native_module_->tiering_budget_array());
+  size_t size = profile_data.size();
+  return {profile_data.ReleaseData(), size};
+#else
+  UNREACHABLE();
+#endif  // V8_ENABLE_WEBASSEMBLY
+}
+
+bool CompiledWasmModule::ApplyProfile(MemorySpan<const uint8_t> profile) {
+#if V8_ENABLE_WEBASSEMBLY
+  TRACE_EVENT0("v8.wasm", "wasm.ApplyProfile");
+  std::unique_ptr<i::wasm::ProfileInformation> pgo_info =
+      i::wasm::RestoreProfileData(
+          native_module_->module(), native_module_->wire_bytes(),
+          native_module_->enabled_features(), {profile.data(), profile.size()});
+  if (!pgo_info) return false;
+  native_module_->compilation_state()->ApplyPgoInfo(pgo_info.get());
+  return true;
+#else
+  UNREACHABLE();
+#endif  // V8_ENABLE_WEBASSEMBLY
+}
+
 Local<ArrayBuffer> v8::WasmMemoryObject::Buffer() {
 #if V8_ENABLE_WEBASSEMBLY
   auto obj = Utils::OpenDirectHandle(this);
@@ -10537,6 +10655,11 @@ void Isolate::SetStackLimit(uintptr_t stack_limit) {
   i_isolate->stack_guard()->SetStackLimit(stack_limit);
 }
 
+void Isolate::SetRegExpBacktrackBudget(uint32_t budget) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i_isolate->set_regexp_backtrack_budget(budget);
+}
+
 void Isolate::GetCodeRange(void** start, size_t* length_in_bytes) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   const base::AddressRegion& code_region = i_isolate->heap()->code_region();
@@ -10632,6 +10755,10 @@ CALLBACK_SETTER(SharedArrayBufferConstructorEnabledCallback,
                 SharedArrayBufferConstructorEnabledCallback,
                 sharedarraybuffer_constructor_enabled_callback)
 
+CALLBACK_SETTER(RegExpBacktrackBudgetExceededCallback,
+                RegExpBacktrackBudgetExceededCallback,
+                regexp_backtrack_budget_exceeded_callback)
+
 // TODO(42203853): Remove this after the deprecated API is removed. Right now,
 // the embedder can still set the callback, but it's never called.
 CALLBACK_SETTER(JavaScriptCompileHintsMagicEnabledCallback,
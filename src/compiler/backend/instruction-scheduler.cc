@@ -4,11 +4,15 @@
 
 #include "src/compiler/backend/instruction-scheduler.h"
 
+#include <algorithm>
+#include <atomic>
 #include <optional>
 
+#include "include/v8-platform.h"
 #include "src/base/iterator.h"
 #include "src/base/utils/random-number-generator.h"
 #include "src/compiler/backend/instruction-codes.h"
+#include "src/init/v8.h"
 
 namespace v8 {
 namespace internal {
@@ -91,6 +95,7 @@ InstructionScheduler::InstructionScheduler(Zone* zone,
 }
 
 void InstructionScheduler::StartBlock(RpoNumber rpo) {
+  DCHECK_NULL(output_);
   DCHECK(graph_.empty());
   DCHECK_NULL(last_side_effect_instr_);
   DCHECK(pending_loads_.empty());
@@ -101,14 +106,70 @@ void InstructionScheduler::StartBlock(RpoNumber rpo) {
 }
 
 void InstructionScheduler::EndBlock(RpoNumber rpo) {
-  if (v8_flags.turbo_stress_instruction_scheduling) {
-    Schedule<StressSchedulerQueue>();
-  } else {
-    Schedule<CriticalPathFirstQueue>();
-  }
+  ScheduleCurrentGraph();
   sequence()->EndBlock(rpo);
 }
 
+void InstructionScheduler::ScheduleBlock(base::Vector<Instruction*> block) {
+  DCHECK_NULL(output_);
+  DCHECK(graph_.empty());
+  if (block.empty()) return;
+  ZoneVector<Instruction*> scheduled(zone());
+  scheduled.reserve(block.size());
+  output_ = &scheduled;
+  for (size_t i = 0; i < block.size() - 1; ++i) {
+    AddInstruction(block[i]);
+  }
+  AddTerminator(block.last());
+  ScheduleCurrentGraph();
+  output_ = nullptr;
+  DCHECK_EQ(block.size(), scheduled.size());
+  std::copy(scheduled.begin(), scheduled.end(), block.begin());
+}
+
+namespace {
+
+class ScheduleBlocksJob final : public JobTask {
+ public:
+  ScheduleBlocksJob(AccountingAllocator* allocator,
+                    base::Vector<base::Vector<Instruction*>> blocks)
+      : allocator_(allocator), blocks_(blocks) {}
+
+  void Run(JobDelegate* delegate) override {
+    Zone zone(allocator_, ZONE_NAME);
+    InstructionScheduler scheduler(&zone, nullptr);
+    while (!delegate->ShouldYield()) {
+      size_t index = next_block_.fetch_add(1, std::memory_order_relaxed);
+      if (index >= blocks_.size()) return;
+      scheduler.ScheduleBlock(blocks_[index]);
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+    size_t next = next_block_.load(std::memory_order_relaxed);
+    return next >= blocks_.size() ? 0 : blocks_.size() - next;
+  }
+
+ private:
+  AccountingAllocator* const allocator_;
+  const base::Vector<base::Vector<Instruction*>> blocks_;
+  std::atomic<size_t> next_block_{0};
+};
+
+}  // namespace
+
+// static
+void InstructionScheduler::ScheduleBlocksConcurrently(
+    AccountingAllocator* allocator,
+    base::Vector<base::Vector<Instruction*>> blocks) {
+  // The calling thread participates in {Join}, so this makes progress even if
+  // no worker thread is available.
+  std::unique_ptr<JobHandle> job_handle = V8::GetCurrentPlatform()->PostJob(
+      TaskPriority::kUserVisible,
+      std::make_unique<ScheduleBlocksJob>(allocator, blocks));
+  job_handle->Join();
+}
+
 void InstructionScheduler::AddTerminator(Instruction* instr) {
   ScheduleGraphNode* new_node = zone()->New<ScheduleGraphNode>(zone(), instr);
   // Make sure that basic block terminators are not moved by adding them
@@ -121,12 +182,8 @@ void InstructionScheduler::AddTerminator(Instruction* instr) {
 
 void InstructionScheduler::AddInstruction(Instruction* instr) {
   if (IsBarrier(instr)) {
-    if (v8_flags.turbo_stress_instruction_scheduling) {
-      Schedule<StressSchedulerQueue>();
-    } else {
-      Schedule<CriticalPathFirstQueue>();
-    }
-    sequence()->AddInstruction(instr);
+    ScheduleCurrentGraph();
+    EmitInstruction(instr);
     return;
   }
 
@@ -230,7 +287,7 @@ void InstructionScheduler::Schedule() {
     ScheduleGraphNode* candidate = ready_list.PopBestCandidate(cycle);
 
     if (candidate != nullptr) {
-      sequence()->AddInstruction(candidate->instruction());
+      EmitInstruction(candidate->instruction());
 
       for (ScheduleGraphNode* successor : candidate->successors()) {
         successor->DropUnscheduledPredecessor();
@@ -255,6 +312,22 @@ void InstructionScheduler::Schedule() {
   last_side_effect_instr_ = nullptr;
 }
 
+void InstructionScheduler::ScheduleCurrentGraph() {
+  if (v8_flags.turbo_stress_instruction_scheduling) {
+    Schedule<StressSchedulerQueue>();
+  } else {
+    Schedule<CriticalPathFirstQueue>();
+  }
+}
+
+void InstructionScheduler::EmitInstruction(Instruction* instr) {
+  if (output_ != nullptr) {
+    output_->push_back(instr);
+  } else {
+    sequence()->AddInstruction(instr);
+  }
+}
+
 int InstructionScheduler::GetInstructionFlags(const Instruction* instr) const {
   switch (instr->arch_opcode()) {
     case kArchNop:
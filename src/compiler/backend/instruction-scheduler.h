@@ -8,6 +8,7 @@
 #include <optional>
 
 #include "src/base/utils/random-number-generator.h"
+#include "src/base/vector.h"
 #include "src/compiler/backend/instruction.h"
 #include "src/zone/zone-containers.h"
 
@@ -43,6 +44,19 @@ class InstructionScheduler final : public ZoneObject {
   V8_EXPORT_PRIVATE void AddInstruction(Instruction* instr);
   V8_EXPORT_PRIVATE void AddTerminator(Instruction* instr);
 
+  // Reorders the instructions of a single block in place. The instructions are
+  // given in program order with the block terminator last. This does not go
+  // through the instruction sequence, so distinct blocks can be scheduled
+  // concurrently by separate schedulers.
+  V8_EXPORT_PRIVATE void ScheduleBlock(base::Vector<Instruction*> block);
+
+  // Schedules all {blocks} as above on worker threads and returns once all of
+  // them are done. Every worker uses its own zone and scheduler, so the result
+  // is the same as scheduling the blocks one after another.
+  V8_EXPORT_PRIVATE static void ScheduleBlocksConcurrently(
+      AccountingAllocator* allocator,
+      base::Vector<base::Vector<Instruction*>> blocks);
+
   static bool SchedulerSupported();
 
  private:
@@ -207,6 +221,14 @@ class InstructionScheduler final : public ZoneObject {
 
   void ComputeTotalLatencies();
 
+  // Schedules the instructions added since the last scheduling point using the
+  // queue selected by the flags.
+  void ScheduleCurrentGraph();
+
+  // Appends {instr} to the current block of the instruction sequence, or to
+  // {output_} when scheduling a standalone block.
+  void EmitInstruction(Instruction* instr);
+
   static int GetInstructionLatency(const Instruction* instr);
 
   Zone* zone() { return zone_; }
@@ -219,6 +241,9 @@ class InstructionScheduler final : public ZoneObject {
   InstructionSequence* sequence_;
   ZoneVector<ScheduleGraphNode*> graph_;
 
+  // Receives the scheduled instructions in {ScheduleBlock}.
+  ZoneVector<Instruction*>* output_ = nullptr;
+
   friend class InstructionSchedulerTester;
 
   // Last side effect instruction encountered while building the graph.
@@ -152,6 +152,14 @@ InstructionSelectorT<Adapter>::SelectInstructions() {
   }
 
   // Schedule the selected instructions.
+  if (UseInstructionScheduling() && UseConcurrentInstructionScheduling()) {
+    ScheduleBlocksConcurrently(blocks);
+#if DEBUG
+    sequence()->ValidateSSA();
+#endif
+    return std::nullopt;
+  }
+
   if (UseInstructionScheduling()) {
     scheduler_ = zone()->template New<InstructionScheduler>(zone(), sequence());
   }
@@ -182,6 +190,67 @@ InstructionSelectorT<Adapter>::SelectInstructions() {
   return std::nullopt;
 }
 
+template <typename Adapter>
+bool InstructionSelectorT<Adapter>::UseConcurrentInstructionScheduling()
+    const {
+  // Blocks are scheduled independently of each other, so large functions can
+  // spread the work over several threads. The stress scheduler draws from a
+  // single random number generator and stays sequential.
+  return v8_flags.turbo_concurrent_instruction_scheduling &&
+         !v8_flags.turbo_stress_instruction_scheduling &&
+         instructions_.size() >=
+             static_cast<size_t>(
+                 v8_flags.turbo_concurrent_instruction_scheduling_threshold);
+}
+
+template <typename Adapter>
+void InstructionSelectorT<Adapter>::ScheduleBlocksConcurrently(
+    const block_range_t& blocks) {
+  // Apply the renames and collect the instructions of every block in program
+  // order, terminator last. Instructions were selected bottom-up, so
+  // {instructions_} holds them in reverse.
+  ZoneVector<Instruction*> ordered(zone());
+  ordered.reserve(instructions_.size());
+  ZoneVector<size_t> block_starts(zone());
+  block_starts.reserve(blocks.size() + 1);
+  for (const block_t block : blocks) {
+    InstructionBlock* instruction_block =
+        sequence()->InstructionBlockAt(this->rpo_number(block));
+    for (size_t i = 0; i < instruction_block->phis().size(); i++) {
+      UpdateRenamesInPhi(instruction_block->PhiAt(i));
+    }
+    size_t end = instruction_block->code_end();
+    size_t start = instruction_block->code_start();
+    DCHECK_LE(end, start);
+    block_starts.push_back(ordered.size());
+    while (start-- > end) {
+      UpdateRenames(instructions_[start]);
+      ordered.push_back(instructions_[start]);
+    }
+  }
+  block_starts.push_back(ordered.size());
+
+  ZoneVector<base::Vector<Instruction*>> block_instructions(zone());
+  block_instructions.reserve(blocks.size());
+  for (size_t i = 0; i < blocks.size(); ++i) {
+    block_instructions.push_back(base::VectorOf(
+        ordered.data() + block_starts[i], block_starts[i + 1] - block_starts[i]));
+  }
+  InstructionScheduler::ScheduleBlocksConcurrently(
+      zone()->allocator(), base::VectorOf(block_instructions));
+
+  // Emit the scheduled blocks in RPO order, which keeps the resulting
+  // instruction sequence independent of how the work was distributed.
+  for (size_t i = 0; i < blocks.size(); ++i) {
+    RpoNumber rpo = this->rpo_number(blocks[i]);
+    sequence()->StartBlock(rpo);
+    for (Instruction* instr : block_instructions[i]) {
+      sequence()->AddInstruction(instr);
+    }
+    sequence()->EndBlock(rpo);
+  }
+}
+
 template <typename Adapter>
 void InstructionSelectorT<Adapter>::StartBlock(RpoNumber rpo) {
   if (UseInstructionScheduling()) {
@@ -697,6 +697,8 @@ class InstructionSelectorT final : public Adapter {
     return (enable_scheduling_ == InstructionSelector::kEnableScheduling) &&
            InstructionScheduler::SchedulerSupported();
   }
+  bool UseConcurrentInstructionScheduling() const;
+  void ScheduleBlocksConcurrently(const block_range_t& blocks);
 
   void AppendDeoptimizeArguments(InstructionOperandVector* args,
                                  DeoptimizeReason reason, id_t node_id,
@@ -949,6 +949,26 @@ void InstructionSequence::ComputeAssemblyOrder() {
     block->set_ao_number(RpoNumber::FromInt(ao++));
     ao_blocks_->push_back(block);
   }
+  if (v8_flags.turbo_order_deferred_blocks) {
+    // Split the deferred blocks into two tiers: slow paths that jump back into
+    // non-deferred code are placed right after the hot code, while blocks that
+    // never return to it (throws, deopts, slow-path returns) are sunk to the
+    // very end. This keeps the hot code and its out-of-line continuations
+    // dense, and leaves the truly cold code at the tail of the instruction
+    // stream.
+    auto rejoins_hot_code = [this](const InstructionBlock* block) {
+      for (RpoNumber succ : block->successors()) {
+        if (!InstructionBlockAt(succ)->IsDeferred()) return true;
+      }
+      return false;
+    };
+    for (InstructionBlock* const block : *instruction_blocks_) {
+      if (block->ao_number() != invalid) continue;
+      if (!rejoins_hot_code(block)) continue;
+      block->set_ao_number(RpoNumber::FromInt(ao++));
+      ao_blocks_->push_back(block);
+    }
+  }
   // Add all leftover (deferred) blocks.
   for (InstructionBlock* const block : *instruction_blocks_) {
     if (block->ao_number() == invalid) {
@@ -20,6 +20,10 @@ void LoopUnrollingAnalyzer::DetectUnrollableLoops() {
     IterationCount iter_count = GetLoopIterationCount(info);
     loop_iteration_count_.insert({start, iter_count});
 
+    if (DetectTypedArrayKernelLoop(info)) {
+      typed_array_kernel_loops_.insert(start);
+    }
+
     if (ShouldFullyUnrollLoop(start) || ShouldPartiallyUnrollLoop(start)) {
       can_unroll_at_least_one_loop_ = true;
     }
@@ -30,6 +34,50 @@ void LoopUnrollingAnalyzer::DetectUnrollableLoops() {
   }
 }
 
+bool LoopUnrollingAnalyzer::DetectTypedArrayKernelLoop(
+    const LoopFinder::LoopInfo& info) {
+  if (is_wasm_ || !v8_flags.turboshaft_unroll_typed_array_loops) return false;
+  if (info.has_inner_loops) return false;
+  if (info.op_count >= kTypedArrayKernelMaxLoopSizeForPartialUnrolling) {
+    return false;
+  }
+
+  bool has_raw_memory_access = false;
+  for (const Block* block : loop_finder_.GetLoopBody(info.start)) {
+    for (const Operation& op : input_graph_->operations(*block)) {
+      switch (op.opcode) {
+        case Opcode::kLoad:
+          if (!op.Cast<LoadOp>().kind.tagged_base) {
+            has_raw_memory_access = true;
+          }
+          break;
+        case Opcode::kStore:
+          if (!op.Cast<StoreOp>().kind.tagged_base) {
+            has_raw_memory_access = true;
+          }
+          break;
+        case Opcode::kCall:
+        case Opcode::kTailCall:
+          // Calls dominate the cost of the loop, so unrolling more won't help.
+          return false;
+        case Opcode::kJSStackCheck:
+          // Loop stack checks are marked as allocating because of the
+          // interrupts they handle, but they are lowered to a compare and a
+          // rarely taken call. They are still in the graph at this point, so
+          // they mustn't disqualify the loop.
+          break;
+        case Opcode::kAllocate:
+          // Allocations are large once lowered, and would make the unrolled
+          // loop too big.
+          return false;
+        default:
+          break;
+      }
+    }
+  }
+  return has_raw_memory_access;
+}
+
 IterationCount LoopUnrollingAnalyzer::GetLoopIterationCount(
     const LoopFinder::LoopInfo& info) const {
   const Block* start = info.start;
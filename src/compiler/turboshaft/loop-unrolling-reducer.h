@@ -26,6 +26,9 @@ namespace v8::internal::compiler::turboshaft {
 // LoopUnrollingReducer fully unrolls small inner loops with a small
 // statically-computable number of iterations, partially unrolls other small
 // inner loops, and remove loops that we detect as always having 0 iterations.
+// Inner JS loops that only do arithmetic and raw (typed array) memory accesses
+// are unrolled with a larger budget, since they profit the most from the
+// additional instruction-level parallelism.
 
 class IterationCount {
   enum class Kind { kExact, kApprox, kUnknown };
@@ -171,6 +174,7 @@ class V8_EXPORT_PRIVATE LoopUnrollingAnalyzer {
         matcher_(*input_graph),
         loop_finder_(phase_zone, input_graph),
         loop_iteration_count_(phase_zone),
+        typed_array_kernel_loops_(phase_zone),
         canonical_loop_matcher_(matcher_),
         is_wasm_(is_wasm),
         stack_checks_to_remove_(input_graph->stack_checks_to_remove()) {
@@ -192,8 +196,21 @@ class V8_EXPORT_PRIVATE LoopUnrollingAnalyzer {
   bool ShouldPartiallyUnrollLoop(const Block* loop_header) const {
     DCHECK(loop_header->IsLoop());
     auto info = loop_finder_.GetLoopInfo(loop_header);
-    return !info.has_inner_loops &&
-           info.op_count < kMaxLoopSizeForPartialUnrolling;
+    size_t max_size = IsTypedArrayKernelLoop(loop_header)
+                          ? kTypedArrayKernelMaxLoopSizeForPartialUnrolling
+                          : kMaxLoopSizeForPartialUnrolling;
+    return !info.has_inner_loops && info.op_count < max_size;
+  }
+
+  size_t GetPartialUnrollingCount(const Block* loop_header) const {
+    DCHECK(ShouldPartiallyUnrollLoop(loop_header));
+    return IsTypedArrayKernelLoop(loop_header)
+               ? kTypedArrayKernelPartialUnrollingCount
+               : kPartialUnrollingCount;
+  }
+
+  bool IsTypedArrayKernelLoop(const Block* loop_header) const {
+    return typed_array_kernel_loops_.contains(loop_header);
   }
 
   bool ShouldRemoveLoop(const Block* loop_header) const {
@@ -227,11 +244,14 @@ class V8_EXPORT_PRIVATE LoopUnrollingAnalyzer {
   static constexpr size_t kWasmMaxLoopSizeForPartialUnrolling = 80;
   static constexpr size_t kMaxLoopIterationsForFullUnrolling = 4;
   static constexpr size_t kPartialUnrollingCount = 4;
+  static constexpr size_t kTypedArrayKernelMaxLoopSizeForPartialUnrolling = 120;
+  static constexpr size_t kTypedArrayKernelPartialUnrollingCount = 8;
   static constexpr size_t kMaxIterForStackCheckRemoval = 5000;
 
  private:
   void DetectUnrollableLoops();
   IterationCount GetLoopIterationCount(const LoopFinder::LoopInfo& info) const;
+  bool DetectTypedArrayKernelLoop(const LoopFinder::LoopInfo& info);
 
   Graph* input_graph_;
   OperationMatcher matcher_;
@@ -240,6 +260,9 @@ class V8_EXPORT_PRIVATE LoopUnrollingAnalyzer {
   // doesn't contain entries for loops for which we don't know the number of
   // iterations.
   ZoneUnorderedMap<const Block*, IterationCount> loop_iteration_count_;
+  // Inner JS loops whose body only contains arithmetic and untagged-base
+  // loads/stores, i.e., loops over typed arrays.
+  ZoneAbslFlatHashSet<const Block*> typed_array_kernel_loops_;
   const StaticCanonicalForLoopMatcher canonical_loop_matcher_;
   const bool is_wasm_;
   const size_t kMaxLoopSizeForPartialUnrolling =
@@ -502,7 +525,8 @@ void LoopUnrollingReducer<Next>::PartiallyUnrollLoop(const Block* header) {
   auto loop_body = analyzer_.GetLoopBody(header);
   current_loop_header_ = header;
 
-  int unroll_count = LoopUnrollingAnalyzer::kPartialUnrollingCount;
+  int unroll_count =
+      static_cast<int>(analyzer_.GetPartialUnrollingCount(header));
 
   ScopedModification<bool> set_true(__ turn_loop_without_backedge_into_merge(),
                                     false);
@@ -0,0 +1,211 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/turboshaft/wasm-bounds-check-elimination-reducer.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#define TRACE(...)                                      \
+  do {                                                  \
+    if (v8_flags.trace_wasm_bounds_check_elimination) { \
+      PrintF(__VA_ARGS__);                              \
+    }                                                   \
+  } while (false)
+
+void WasmBoundsCheckEliminationAnalyzer::Run() {
+  // Facts have to be collected up-front as a value may be used in a loop
+  // before the branch restricting it on the backedge is visited.
+  for (const Block& block : graph_.blocks()) {
+    if (const BranchOp* branch =
+            graph_.Get(block.LastOperation(graph_)).TryCast<BranchOp>()) {
+      RecordBranchFacts(*branch);
+    }
+  }
+  if (facts_.empty()) return;
+
+  for (const Block& block : graph_.blocks()) {
+    for (OpIndex index : graph_.OperationIndices(block)) {
+      const TrapIfOp* trap = graph_.Get(index).TryCast<TrapIfOp>();
+      if (trap == nullptr) continue;
+      if (TrapIsRedundant(*trap, &block)) {
+        TRACE("[wasm-bce] Eliminating trap #%u in block B%u\n", index.id(),
+              block.index().id());
+        redundant_traps_.insert(index);
+      }
+    }
+  }
+}
+
+void WasmBoundsCheckEliminationAnalyzer::RecordBranchFacts(
+    const BranchOp& branch) {
+  const ComparisonOp* cmp =
+      graph_.Get(branch.condition()).TryCast<ComparisonOp>();
+  if (cmp == nullptr || !cmp->rep.IsWord()) return;
+  WordRepresentation rep = WordRepresentation(cmp->rep);
+  bool or_equal;
+  switch (cmp->kind) {
+    case ComparisonOp::Kind::kUnsignedLessThan:
+      or_equal = false;
+      break;
+    case ComparisonOp::Kind::kUnsignedLessThanOrEqual:
+      or_equal = true;
+      break;
+    default:
+      return;
+  }
+  // A fact only holds on an edge. Since critical edges are split, the target
+  // of the edge dominates everything that is reached through it if it has a
+  // single predecessor.
+  uint64_t constant;
+  if (matcher_.MatchIntegralWordConstant(cmp->right(), rep, &constant)) {
+    // `x < C` or `x <= C` holds in the true successor.
+    if (!or_equal && constant == 0) return;
+    AddFact(cmp->left(), branch.if_true, or_equal ? constant : constant - 1);
+  } else if (matcher_.MatchIntegralWordConstant(cmp->left(), rep,
+                                                &constant)) {
+    // `!(C < x)` or `!(C <= x)` holds in the false successor.
+    if (or_equal && constant == 0) return;
+    AddFact(cmp->right(), branch.if_false, or_equal ? constant - 1 : constant);
+  }
+}
+
+void WasmBoundsCheckEliminationAnalyzer::AddFact(OpIndex value,
+                                                 const Block* block,
+                                                 uint64_t bound) {
+  if (block->PredecessorCount() != 1) return;
+  auto it = facts_.find(value);
+  if (it == facts_.end()) {
+    it = facts_.emplace(value, ZoneVector<Fact>(zone_)).first;
+  }
+  it->second.push_back({block, bound});
+}
+
+bool WasmBoundsCheckEliminationAnalyzer::TrapIsRedundant(const TrapIfOp& trap,
+                                                         const Block* block) {
+  // Only `TrapIfNot(index < C)` is handled, which is the shape of the
+  // memory64 guard region check.
+  if (!trap.negated) return false;
+  const ComparisonOp* cmp =
+      graph_.Get(trap.condition()).TryCast<ComparisonOp>();
+  if (cmp == nullptr || !cmp->rep.IsWord()) return false;
+  WordRepresentation rep = WordRepresentation(cmp->rep);
+  uint64_t limit;
+  if (!matcher_.MatchIntegralWordConstant(cmp->right(), rep, &limit)) {
+    return false;
+  }
+  switch (cmp->kind) {
+    case ComparisonOp::Kind::kUnsignedLessThan:
+      return UpperBound(cmp->left(), block, 0) < limit;
+    case ComparisonOp::Kind::kUnsignedLessThanOrEqual:
+      return UpperBound(cmp->left(), block, 0) <= limit;
+    default:
+      return false;
+  }
+}
+
+uint64_t WasmBoundsCheckEliminationAnalyzer::UpperBound(OpIndex value,
+                                                        const Block* block,
+                                                        int depth) {
+  const Operation& op = graph_.Get(value);
+  if (op.outputs_rep().size() != 1 || !op.outputs_rep()[0].IsWord()) {
+    return std::numeric_limits<uint64_t>::max();
+  }
+  WordRepresentation rep = WordRepresentation(op.outputs_rep()[0]);
+  uint64_t bound = rep.MaxUnsignedValue();
+  if (auto it = facts_.find(value); it != facts_.end()) {
+    for (const Fact& fact : it->second) {
+      if (fact.bound < bound && block->IsDominatedBy(fact.block)) {
+        bound = fact.bound;
+      }
+    }
+  }
+  if (depth >= kMaxDepth) return bound;
+  return std::min(bound, ComputeUpperBound(value, rep, block, depth + 1));
+}
+
+uint64_t WasmBoundsCheckEliminationAnalyzer::ComputeUpperBound(
+    OpIndex value, WordRepresentation rep, const Block* block, int depth) {
+  const uint64_t max = rep.MaxUnsignedValue();
+  uint64_t constant;
+  if (matcher_.MatchIntegralWordConstant(value, rep, &constant)) {
+    return constant;
+  }
+
+  const Operation& op = graph_.Get(value);
+  if (const ChangeOp* change = op.TryCast<ChangeOp>()) {
+    if (change->kind == ChangeOp::Kind::kZeroExtend) {
+      return UpperBound(change->input(), block, depth);
+    }
+    return max;
+  }
+
+  if (const WordBinopOp* binop = op.TryCast<WordBinopOp>()) {
+    switch (binop->kind) {
+      case WordBinopOp::Kind::kBitwiseAnd:
+        return std::min(UpperBound(binop->left(), block, depth),
+                        UpperBound(binop->right(), block, depth));
+      case WordBinopOp::Kind::kAdd: {
+        uint64_t left = UpperBound(binop->left(), block, depth);
+        uint64_t right = UpperBound(binop->right(), block, depth);
+        if (left > max - right) return max;
+        return left + right;
+      }
+      case WordBinopOp::Kind::kMul: {
+        uint64_t left = UpperBound(binop->left(), block, depth);
+        uint64_t right = UpperBound(binop->right(), block, depth);
+        if (right != 0 && left > max / right) return max;
+        return left * right;
+      }
+      default:
+        return max;
+    }
+  }
+
+  if (const ShiftOp* shift = op.TryCast<ShiftOp>()) {
+    uint64_t amount;
+    if (!matcher_.MatchIntegralWordConstant(shift->right(),
+                                            WordRepresentation::Word32(),
+                                            &amount)) {
+      return max;
+    }
+    // Shift amounts are taken modulo the bit width.
+    amount &= rep.bit_width() - 1;
+    uint64_t left = UpperBound(shift->left(), block, depth);
+    switch (shift->kind) {
+      case ShiftOp::Kind::kShiftRightLogical:
+        return left >> amount;
+      case ShiftOp::Kind::kShiftLeft:
+        if (left > (max >> amount)) return max;
+        return left << amount;
+      default:
+        return max;
+    }
+  }
+
+  if (const PhiOp* phi = op.TryCast<PhiOp>()) {
+    // A phi that is currently being analyzed (e.g. a loop phi reached through
+    // its backedge input) gets no bound; the bound then has to come from a
+    // fact on the backedge.
+    if (!phis_in_progress_.insert(value).second) return max;
+    const Block& phi_block = graph_.Get(graph_.BlockOf(value));
+    base::SmallVector<Block*, 8> predecessors = phi_block.Predecessors();
+    uint64_t result = 0;
+    if (predecessors.size() == phi->input_count) {
+      for (size_t i = 0; i < phi->input_count && result < max; ++i) {
+        result = std::max(
+            result, UpperBound(phi->input(i), predecessors[i], depth));
+      }
+    } else {
+      result = max;
+    }
+    phis_in_progress_.erase(value);
+    return result;
+  }
+
+  return max;
+}
+
+#undef TRACE
+
+}  // namespace v8::internal::compiler::turboshaft
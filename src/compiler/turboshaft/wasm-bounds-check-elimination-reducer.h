@@ -0,0 +1,113 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#if !V8_ENABLE_WEBASSEMBLY
+#error This header should only be included if WebAssembly is enabled.
+#endif  // !V8_ENABLE_WEBASSEMBLY
+
+#ifndef V8_COMPILER_TURBOSHAFT_WASM_BOUNDS_CHECK_ELIMINATION_REDUCER_H_
+#define V8_COMPILER_TURBOSHAFT_WASM_BOUNDS_CHECK_ELIMINATION_REDUCER_H_
+
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/graph.h"
+#include "src/compiler/turboshaft/operation-matcher.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+// The WasmBoundsCheckEliminationReducer removes traps of the form
+// `TrapIfNot(index < C)` for a constant C if a simple range analysis proves
+// that {index} is always below C. This mostly targets the guard region check
+// of memory64 accesses with trap handling, which compares the index against
+// the (constant) size of the guard region.
+//
+// Upper bounds of a value are derived from
+// - the operation computing it (constants, zero-extensions, masks, shifts,
+//   additions and multiplications),
+// - dominating branches comparing the value against a constant, and
+// - for phis, the bounds of their inputs at the end of the respective
+//   predecessor.
+// Together, this covers loops with canonical induction variables, e.g.:
+//    loop                          // i = phi(0, i')
+//      (i64.load (i64.shl (local.get $i) (i64.const 3)))
+//      (local.set $i (i64.add (local.get $i) (i64.const 1)))  // i'
+//      (br_if 0 (i64.lt_u (local.get $i) (i64.const 1000)))
+//    end
+// Here, i' is at most 999 on the backedge, so the loaded index is at most
+// 999 * 8.
+class WasmBoundsCheckEliminationAnalyzer {
+ public:
+  WasmBoundsCheckEliminationAnalyzer(const Graph& graph, Zone* phase_zone)
+      : graph_(graph),
+        matcher_(graph),
+        zone_(phase_zone),
+        facts_(phase_zone),
+        phis_in_progress_(phase_zone),
+        redundant_traps_(phase_zone) {}
+
+  void Run();
+
+  bool IsRedundant(OpIndex trap) const {
+    return redundant_traps_.contains(trap);
+  }
+
+ private:
+  // A dominating branch guarantees {value <= bound} in all blocks dominated by
+  // {block}.
+  struct Fact {
+    const Block* block;
+    uint64_t bound;
+  };
+
+  void RecordBranchFacts(const BranchOp& branch);
+  void AddFact(OpIndex value, const Block* block, uint64_t bound);
+  bool TrapIsRedundant(const TrapIfOp& trap, const Block* block);
+
+  // Returns an inclusive upper bound of the unsigned {value} in {block}.
+  uint64_t UpperBound(OpIndex value, const Block* block, int depth);
+  uint64_t ComputeUpperBound(OpIndex value, WordRepresentation rep,
+                             const Block* block, int depth);
+
+  // Limits the size of the expressions that are analyzed.
+  static constexpr int kMaxDepth = 6;
+
+  const Graph& graph_;
+  const OperationMatcher matcher_;
+  Zone* zone_;
+  ZoneAbslFlatHashMap<OpIndex, ZoneVector<Fact>> facts_;
+  ZoneAbslFlatHashSet<OpIndex> phis_in_progress_;
+  ZoneAbslFlatHashSet<OpIndex> redundant_traps_;
+};
+
+template <class Next>
+class WasmBoundsCheckEliminationReducer : public Next {
+ public:
+  TURBOSHAFT_REDUCER_BOILERPLATE(WasmBoundsCheckElimination)
+
+  void Analyze() {
+    if (v8_flags.wasm_bounds_check_elimination) analyzer_.Run();
+    Next::Analyze();
+  }
+
+  V<None> REDUCE_INPUT_GRAPH(TrapIf)(V<None> ig_index, const TrapIfOp& trap) {
+    LABEL_BLOCK(no_change) {
+      return Next::ReduceInputGraphTrapIf(ig_index, trap);
+    }
+    if (ShouldSkipOptimizationStep()) goto no_change;
+    if (analyzer_.IsRedundant(ig_index)) {
+      // `TrapIf` doesn't produce a value.
+      return V<None>::Invalid();
+    }
+    goto no_change;
+  }
+
+ private:
+  WasmBoundsCheckEliminationAnalyzer analyzer_{Asm().input_graph(),
+                                               Asm().phase_zone()};
+};
+
+}  // namespace v8::internal::compiler::turboshaft
+
+#endif  // V8_COMPILER_TURBOSHAFT_WASM_BOUNDS_CHECK_ELIMINATION_REDUCER_H_
@@ -2120,9 +2120,13 @@ void IrRegExpData::IrRegExpDataVerify(Isolate* isolate) {
   switch (type_tag()) {
     case RegExpData::Type::EXPERIMENTAL: {
       if (has_latin1_code()) {
-        CHECK_EQ(latin1_code(isolate)->builtin_id(),
-                 Builtin::kRegExpExperimentalTrampoline);
-        CHECK_EQ(latin1_code(isolate), uc16_code(isolate));
+        // Each code slot holds either the trampoline to the experimental
+        // interpreter or, after tier-up, native irregexp code.
+        for (bool is_one_byte : {true, false}) {
+          Tagged<Code> code = this->code(isolate, is_one_byte);
+          CHECK(code->builtin_id() == Builtin::kRegExpExperimentalTrampoline ||
+                code->kind() == CodeKind::REGEXP);
+        }
         CHECK(Is<TrustedByteArray>(latin1_bytecode()));
         CHECK_EQ(latin1_bytecode(), uc16_bytecode());
       } else {
@@ -2132,7 +2136,13 @@ void IrRegExpData::IrRegExpDataVerify(Isolate* isolate) {
       }
 
       CHECK_EQ(max_register_count(), JSRegExp::kUninitializedValue);
-      CHECK_EQ(ticks_until_tier_up(), JSRegExp::kUninitializedValue);
+      if (v8_flags.experimental_regexp_engine_tier_up) {
+        CHECK_GE(ticks_until_tier_up(), JSRegExp::kUninitializedValue);
+        CHECK_LE(ticks_until_tier_up(),
+                 v8_flags.experimental_regexp_engine_tier_up_ticks);
+      } else {
+        CHECK_EQ(ticks_until_tier_up(), JSRegExp::kUninitializedValue);
+      }
       CHECK_EQ(backtrack_limit(), JSRegExp::kUninitializedValue);
 
       break;
@@ -106,6 +106,7 @@
 #include "src/objects/waiter-queue-node.h"
 #include "src/profiler/heap-profiler.h"
 #include "src/profiler/tracing-cpu-profiler.h"
+#include "src/regexp/experimental/experimental-interpreter.h"
 #include "src/regexp/regexp-stack.h"
 #include "src/roots/roots.h"
 #include "src/roots/static-roots.h"
@@ -4553,6 +4554,9 @@ Isolate::~Isolate() {
   delete regexp_stack_;
   regexp_stack_ = nullptr;
 
+  delete experimental_regexp_dfa_cache_;
+  experimental_regexp_dfa_cache_ = nullptr;
+
   delete descriptor_lookup_cache_;
   descriptor_lookup_cache_ = nullptr;
 
@@ -5375,6 +5379,7 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
   define_own_stub_cache_ = new StubCache(this);
   materialized_object_store_ = new MaterializedObjectStore(this);
   regexp_stack_ = new RegExpStack();
+  experimental_regexp_dfa_cache_ = new ExperimentalRegExpDfaCache();
   date_cache_ = new DateCache();
   heap_profiler_ = new HeapProfiler(heap());
   interpreter_ = new interpreter::Interpreter(this);
@@ -6891,6 +6896,15 @@ void Isolate::CountUsage(
   }
 }
 
+void Isolate::ReportRegExpBacktrackBudgetExceeded(DirectHandle<String> source,
+                                                  int flags) {
+  counters()->regexp_fallback_to_experimental()->Increment();
+  if (regexp_backtrack_budget_exceeded_callback() == nullptr) return;
+  HandleScope handle_scope(this);
+  regexp_backtrack_budget_exceeded_callback()(
+      reinterpret_cast<v8::Isolate*>(this), v8::Utils::ToLocal(source), flags);
+}
+
 int Isolate::GetNextScriptId() { return heap()->NextScriptId(); }
 
 // static
@@ -125,6 +125,7 @@ class Deoptimizer;
 class DescriptorLookupCache;
 class EmbeddedFileWriterInterface;
 class EternalHandles;
+class ExperimentalRegExpDfaCache;
 class GlobalHandles;
 class GlobalSafepoint;
 class HandleScopeImplementer;
@@ -521,6 +522,11 @@ using DebugObjectCache = std::vector<Handle<HeapObject>>;
   V(JavaScriptCompileHintsMagicEnabledCallback,                               \
     compile_hints_magic_enabled_callback, nullptr)                            \
   V(WasmJSPIEnabledCallback, wasm_jspi_enabled_callback, nullptr)             \
+  V(RegExpBacktrackBudgetExceededCallback,                                    \
+    regexp_backtrack_budget_exceeded_callback, nullptr)                       \
+  /* Backtrack budget of regexps that can fall back to the experimental */    \
+  /* engine, see v8::Isolate::SetRegExpBacktrackBudget. 0 means unset. */     \
+  V(uint32_t, regexp_backtrack_budget, 0)                                     \
   /* State for Relocatable. */                                                \
   V(Relocatable*, relocatable_top, nullptr)                                   \
   V(DebugObjectCache*, string_stream_debug_object_cache, nullptr)             \
@@ -1409,6 +1415,10 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   RegExpStack* regexp_stack() const { return regexp_stack_; }
 
+  ExperimentalRegExpDfaCache* experimental_regexp_dfa_cache() const {
+    return experimental_regexp_dfa_cache_;
+  }
+
   size_t total_regexp_code_generated() const {
     return total_regexp_code_generated_;
   }
@@ -1752,6 +1762,11 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   // separately for each feature.
   void CountUsage(base::Vector<const v8::Isolate::UseCounterFeature> features);
 
+  // Called when a regexp execution exceeded its backtrack budget and is re-run
+  // on the experimental engine.
+  void ReportRegExpBacktrackBudgetExceeded(DirectHandle<String> source,
+                                           int flags);
+
   static std::string GetTurboCfgFileName(Isolate* isolate);
 
   int GetNextScriptId();
@@ -2474,6 +2489,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
       regexp_macro_assembler_canonicalize_;
 #endif  // !V8_INTL_SUPPORT
   RegExpStack* regexp_stack_ = nullptr;
+  ExperimentalRegExpDfaCache* experimental_regexp_dfa_cache_ = nullptr;
   std::vector<int> regexp_indices_;
   DateCache* date_cache_ = nullptr;
   base::RandomNumberGenerator* random_number_generator_ = nullptr;
@@ -562,11 +562,17 @@ DEFINE_BOOL(maglev_destroy_on_background, true,
 DEFINE_BOOL(maglev_inline_api_calls, false,
             "Inline CallApiCallback builtin into generated code")
 DEFINE_EXPERIMENTAL_FEATURE(maglev_licm, "loop invariant code motion")
+DEFINE_EXPERIMENTAL_FEATURE(
+    maglev_bounds_check_elimination,
+    "eliminate int32 and typed array bounds checks in maglev that are "
+    "dominated by an equivalent check, and hoist loop invariant ones")
+DEFINE_WEAK_IMPLICATION(maglev_bounds_check_elimination, maglev_licm)
 DEFINE_WEAK_IMPLICATION(maglev_future, maglev_optimistic_peeled_loops)
 DEFINE_WEAK_IMPLICATION(maglev_future, maglev_speculative_hoist_phi_untagging)
 DEFINE_WEAK_IMPLICATION(maglev_future, maglev_inline_api_calls)
 DEFINE_WEAK_IMPLICATION(maglev_future, maglev_escape_analysis)
 DEFINE_WEAK_IMPLICATION(maglev_future, maglev_licm)
+DEFINE_WEAK_IMPLICATION(maglev_future, maglev_bounds_check_elimination)
 // This might be too big of a hammer but we must prohibit moving the C++
 // trampolines while we are executing a C++ code.
 DEFINE_NEG_IMPLICATION(maglev_inline_api_calls, compact_code_space_with_stack)
@@ -1313,6 +1319,9 @@ DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
 DEFINE_BOOL(turbo_loop_peeling, true, "TurboFan loop peeling")
 DEFINE_BOOL(turbo_loop_variable, true, "TurboFan loop variable optimization")
 DEFINE_BOOL(turbo_loop_rotation, true, "TurboFan loop rotation")
+DEFINE_BOOL(turbo_order_deferred_blocks, false,
+            "place deferred blocks that rejoin hot code before terminal "
+            "deferred blocks in the assembly order")
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
 DEFINE_BOOL(turbo_escape, true, "enable escape analysis")
 DEFINE_BOOL(turbo_allocation_folding, true, "TurboFan allocation folding")
@@ -1322,6 +1331,11 @@ DEFINE_BOOL(turbo_stress_instruction_scheduling, false,
             "randomly schedule instructions to stress dependency tracking")
 DEFINE_IMPLICATION(turbo_stress_instruction_scheduling,
                    turbo_instruction_scheduling)
+DEFINE_BOOL(turbo_concurrent_instruction_scheduling, false,
+            "schedule the blocks of large functions on multiple threads")
+DEFINE_INT(turbo_concurrent_instruction_scheduling_threshold, 20000,
+           "minimum number of instructions for scheduling blocks on multiple "
+           "threads")
 DEFINE_BOOL(turbo_store_elimination, true,
             "enable store-store elimination in TurboFan")
 DEFINE_BOOL(trace_store_elimination, false, "trace store elimination")
@@ -1409,6 +1423,9 @@ DEFINE_BOOL(turboshaft_load_elimination, true,
 DEFINE_BOOL(turboshaft_loop_peeling, false, "enable Turboshaft's loop peeling")
 DEFINE_BOOL(turboshaft_loop_unrolling, true,
             "enable Turboshaft's loop unrolling")
+DEFINE_BOOL(turboshaft_unroll_typed_array_loops, false,
+            "unroll inner loops that only do arithmetic and typed array "
+            "accesses more aggressively in Turboshaft")
 
 DEFINE_EXPERIMENTAL_FEATURE(turboshaft_typed_optimizations,
                             "enable an additional Turboshaft phase that "
@@ -1445,6 +1462,7 @@ DEFINE_WEAK_IMPLICATION(turboshaft_future,
 #endif
 DEFINE_WEAK_IMPLICATION(turboshaft_future,
                         turboshaft_wasm_instruction_selection_staged)
+DEFINE_WEAK_IMPLICATION(turboshaft_future, turboshaft_unroll_typed_array_loops)
 
 #if V8_ENABLE_WEBASSEMBLY
 // Shared-everything is implemented on turboshaft only for now.
@@ -1547,6 +1565,9 @@ DEFINE_BOOL(wasm_async_compilation, true,
 DEFINE_NEG_IMPLICATION(single_threaded, wasm_async_compilation)
 DEFINE_BOOL(wasm_test_streaming, false,
             "use streaming compilation instead of async compilation for tests")
+DEFINE_UINT(wasm_streaming_commit_size, 256,
+            "during streaming compilation, start compiling received functions "
+            "after this many KB of function bodies, even within a chunk")
 DEFINE_BOOL(wasm_native_module_cache_enabled, true,
             "enable the native module cache")
 DEFINE_BOOL(turboshaft_wasm_wrappers, false,
@@ -1601,10 +1622,18 @@ DEFINE_DEBUG_BOOL(trace_wasm_stack_switching, false,
                   "trace wasm stack switching")
 DEFINE_INT(wasm_stack_switching_stack_size, V8_DEFAULT_STACK_SIZE_KB,
            "default size of stacks for wasm stack-switching (in kB)")
+DEFINE_INT(wasm_growable_stack_initial_size, 32,
+           "initial size of growable stacks for wasm stack-switching (in kB)")
+DEFINE_UINT(wasm_stack_pool_size, 4 * MB / KB,
+            "maximum total size of finished wasm stacks that are kept for "
+            "reuse (in kB)")
 DEFINE_BOOL(liftoff, true,
             "enable Liftoff, the baseline compiler for WebAssembly")
 DEFINE_BOOL(liftoff_only, false,
             "disallow TurboFan compilation for WebAssembly (for testing)")
+DEFINE_BOOL(liftoff_loop_analysis, false,
+            "analyze locals assigned in loops in Liftoff, and keep "
+            "loop-invariant locals in registers")
 DEFINE_IMPLICATION(liftoff_only, liftoff)
 DEFINE_NEG_IMPLICATION(liftoff_only, wasm_tier_up)
 DEFINE_NEG_IMPLICATION(liftoff_only, wasm_dynamic_tiering)
@@ -1641,6 +1670,13 @@ DEFINE_NEG_IMPLICATION(experimental_wasm_pgo_to_file, single_threaded)
 DEFINE_BOOL(
     experimental_wasm_pgo_from_file, false,
     "experimental: read and use Wasm PGO data from a local file (for testing)")
+DEFINE_STRING(experimental_wasm_code_cache_dir, nullptr,
+              "experimental: directory of serialized Wasm modules which is "
+              "consulted before compiling and can be shared by processes "
+              "(asynchronous streaming compilation only writes to it)")
+DEFINE_UINT(experimental_wasm_code_cache_dir_slots, 64,
+            "experimental: maximum number of entries in the Wasm code cache "
+            "directory")
 
 DEFINE_BOOL(validate_asm, true,
             "validate asm.js modules and translate them to Wasm")
@@ -1755,6 +1791,11 @@ DEFINE_BOOL(wasm_loop_unrolling, true,
 DEFINE_BOOL(wasm_loop_peeling, true, "enable loop peeling for wasm functions")
 DEFINE_SIZE_T(wasm_loop_peeling_max_size, 1000, "maximum size for peeling")
 DEFINE_BOOL(trace_wasm_loop_peeling, false, "trace wasm loop peeling")
+DEFINE_BOOL(wasm_bounds_check_elimination, false,
+            "eliminate memory64 guard region checks that are proven to be "
+            "redundant by a range analysis")
+DEFINE_BOOL(trace_wasm_bounds_check_elimination, false,
+            "trace wasm bounds check elimination")
 DEFINE_BOOL(wasm_fuzzer_gen_test, false,
             "generate a test case when running a wasm fuzzer")
 DEFINE_IMPLICATION(wasm_fuzzer_gen_test, single_threaded)
@@ -1773,6 +1814,9 @@ DEFINE_EXPERIMENTAL_FEATURE(
     wasm_lazy_validation,
     "enable lazy validation for lazily compiled wasm functions")
 DEFINE_WEAK_IMPLICATION(wasm_lazy_validation, wasm_lazy_compilation)
+DEFINE_BOOL(wasm_lazy_background_compilation, false,
+            "with lazy compilation, compile all functions with the baseline "
+            "tier in the background once the module is instantiated")
 DEFINE_BOOL(wasm_simd_ssse3_codegen, false, "allow wasm SIMD SSSE3 codegen")
 
 DEFINE_BOOL(wasm_code_gc, true, "enable garbage collection of wasm code")
@@ -1829,6 +1873,9 @@ DEFINE_BOOL_READONLY(wasm_memory64_trap_handling, false,
                      "Use trap handling for Wasm memory64 bounds checks (not "
                      "supported for this architecture)")
 #endif  // V8_TARGET_ARCH_ARM64 || V8_TARGET_ARCH_X64
+DEFINE_UINT(wasm_memory_pool_size, 0,
+            "maximum number of freed Wasm memory reservations that are kept "
+            "for reuse by later instantiations (0 disables pooling)")
 
 #ifdef V8_ENABLE_DRUMBRAKE
 // DrumBrake flags.
@@ -2687,6 +2734,14 @@ DEFINE_INT(regexp_tier_up_ticks, 1,
 DEFINE_BOOL(regexp_peephole_optimization, REGEXP_PEEPHOLE_OPTIMIZATION_BOOL,
             "enable peephole optimization for regexp bytecode")
 DEFINE_BOOL(regexp_results_cache, true, "enable the regexp results cache")
+DEFINE_BOOL(regexp_shared_bytecode_cache, true,
+            "share compiled regexp bytecode between isolates")
+DEFINE_INT(regexp_shared_bytecode_cache_max_size, 4 * KB,
+           "maximum size of the process-wide regexp bytecode cache (in KB)")
+DEFINE_BOOL(regexp_bytecode_in_code_cache, false,
+            "include the bytecode of compiled regexp literals in the code "
+            "cache")
+DEFINE_IMPLICATION(regexp_bytecode_in_code_cache, regexp_shared_bytecode_cache)
 DEFINE_BOOL(trace_regexp_peephole_optimization, false,
             "trace regexp bytecode peephole optimization")
 DEFINE_BOOL(trace_regexp_bytecodes, false, "trace regexp bytecode execution")
@@ -2709,6 +2764,28 @@ DEFINE_IMPLICATION(experimental_regexp_engine_capture_group_opt,
 DEFINE_UINT64(experimental_regexp_engine_capture_group_opt_max_memory_usage,
               1024,
               "maximum memory usage in MB allowed for experimental engine")
+DEFINE_BOOL(experimental_regexp_engine_lazy_dfa, false,
+            "use a lazily constructed DFA to skip searches without a match "
+            "in the experimental regexp engine (incomplete: not yet "
+            "benchmarked, hence off by default)")
+DEFINE_UINT(experimental_regexp_engine_dfa_max_states, 2000,
+            "maximum number of states of the lazy DFA of the experimental "
+            "regexp engine")
+DEFINE_BOOL(experimental_regexp_engine_tier_up, true,
+            "tier up hot experimental regexps to native irregexp code that "
+            "falls back to the experimental engine on excessive backtracking")
+DEFINE_NEG_IMPLICATION(regexp_interpret_all, experimental_regexp_engine_tier_up)
+DEFINE_INT(experimental_regexp_engine_tier_up_ticks, 10,
+           "set the number of executions for the experimental regexp engine "
+           "before tiering-up to native code")
+DEFINE_BOOL(experimental_regexp_engine_parallel_global_match, false,
+            "search large subjects of global experimental regexps on "
+            "multiple threads")
+DEFINE_NEG_IMPLICATION(single_threaded,
+                       experimental_regexp_engine_parallel_global_match)
+DEFINE_INT(experimental_regexp_engine_parallel_global_match_min_length, 1 * MB,
+           "minimum subject length for searching a global experimental "
+           "regexp on multiple threads")
 DEFINE_BOOL(trace_experimental_regexp_engine, false,
             "trace execution of experimental regexp engine")
 
@@ -2718,7 +2795,8 @@ DEFINE_BOOL(enable_experimental_regexp_engine_on_excessive_backtracks, false,
 DEFINE_UINT(regexp_backtracks_before_fallback, 50000,
             "number of backtracks during regexp execution before fall back "
             "to experimental engine if "
-            "enable_experimental_regexp_engine_on_excessive_backtracks is set")
+            "enable_experimental_regexp_engine_on_excessive_backtracks is set, "
+            "or in experimental regexps tiered up to native code")
 
 #if V8_TARGET_ARCH_X64 || V8_TARGET_ARCH_ARM64
 DEFINE_BOOL(regexp_simd, true, "enable SIMD for regexp jit code")
@@ -3245,6 +3323,8 @@ DEFINE_NEG_IMPLICATION(single_threaded, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(single_threaded,
                        parallel_compile_tasks_for_eager_toplevel)
 DEFINE_NEG_IMPLICATION(single_threaded, parallel_compile_tasks_for_lazy)
+DEFINE_NEG_IMPLICATION(single_threaded,
+                       turbo_concurrent_instruction_scheduling)
 #ifdef V8_ENABLE_MAGLEV
 DEFINE_NEG_IMPLICATION(single_threaded, maglev_deopt_data_on_background)
 DEFINE_NEG_IMPLICATION(single_threaded, maglev_build_code_on_background)
@@ -4181,7 +4181,11 @@ Handle<RegExpData> Factory::NewExperimentalRegExpData(
   instance->set_capture_name_map(Smi::FromInt(JSRegExp::kUninitializedValue));
   instance->set_max_register_count(JSRegExp::kUninitializedValue);
   instance->set_capture_count(capture_count);
-  instance->set_ticks_until_tier_up(JSRegExp::kUninitializedValue);
+  int ticks_until_tier_up =
+      v8_flags.experimental_regexp_engine_tier_up
+          ? v8_flags.experimental_regexp_engine_tier_up_ticks
+          : JSRegExp::kUninitializedValue;
+  instance->set_ticks_until_tier_up(ticks_until_tier_up);
   instance->set_backtrack_limit(JSRegExp::kUninitializedValue);
   Tagged<RegExpDataWrapper> raw_wrapper = *wrapper;
   instance->set_wrapper(raw_wrapper);
@@ -111,6 +111,7 @@
 #include "src/objects/slots-inl.h"
 #include "src/objects/visitors.h"
 #include "src/profiler/heap-profiler.h"
+#include "src/regexp/experimental/experimental-interpreter.h"
 #include "src/regexp/regexp.h"
 #include "src/snapshot/embedded/embedded-data.h"
 #include "src/snapshot/serializer-deserializer.h"
@@ -2720,6 +2721,7 @@ void Heap::MarkCompactPrologue() {
   isolate_->descriptor_lookup_cache()->Clear();
   RegExpResultsCache::Clear(string_split_cache());
   RegExpResultsCache::Clear(regexp_multiple_cache());
+  isolate_->experimental_regexp_dfa_cache()->Clear();
 
   FlushNumberStringCache();
 }
@@ -2440,6 +2440,7 @@ class Heap final {
   friend class PauseAllocationObserversScope;
   friend class PretenuringHandler;
   friend class ReadOnlyRoots;
+  friend class RegExpResultsCache;
   friend class DisableConservativeStackScanningScopeForTesting;
   friend class Scavenger;
   friend class ScavengerCollector;
@@ -365,6 +365,12 @@ namespace internal {
   SC(maps_created, V8.MapsCreated)                                             \
   SC(megamorphic_stub_cache_updates, V8.MegamorphicStubCacheUpdates)           \
   SC(regexp_entry_runtime, V8.RegExpEntryRuntime)                              \
+  SC(regexp_fallback_to_experimental, V8.RegExpFallbackToExperimental)         \
+  SC(regexp_results_cache_hits, V8.RegExpResultsCacheHits)                     \
+  SC(regexp_results_cache_misses, V8.RegExpResultsCacheMisses)                 \
+  SC(regexp_results_cache_evictions, V8.RegExpResultsCacheEvictions)           \
+  SC(regexp_bytecode_cache_hits, V8.RegExpBytecodeCacheHits)                   \
+  SC(regexp_bytecode_cache_misses, V8.RegExpBytecodeCacheMisses)               \
   SC(stack_interrupts, V8.StackInterrupts)                                     \
   SC(new_space_bytes_available, V8.MemoryNewSpaceBytesAvailable)               \
   SC(new_space_bytes_committed, V8.MemoryNewSpaceBytesCommitted)               \
@@ -277,6 +277,7 @@ class RuntimeCallTimer final {
   V(StringObject_StringValue)                              \
   V(String_Write)                                          \
   V(String_WriteUtf8)                                      \
+  V(String_WriteUtf8WithResize)                            \
   V(Symbol_New)                                            \
   V(SymbolObject_New)                                      \
   V(SymbolObject_SymbolValue)                              \
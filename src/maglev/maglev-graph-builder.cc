@@ -4797,7 +4797,7 @@ ValueNode* MaglevGraphBuilder::BuildLoadField(
 
   // Do the load.
   if (field_index.is_double()) {
-    return AddNewNode<LoadDoubleField>({load_source}, field_index.offset());
+    return BuildLoadDoubleField(load_source, field_index.offset());
   }
   ValueNode* value = BuildLoadTaggedField<LoadTaggedFieldForProperty>(
       load_source, field_index.offset(), name);
@@ -4821,6 +4821,37 @@ ValueNode* MaglevGraphBuilder::BuildLoadField(
   return value;
 }
 
+ValueNode* MaglevGraphBuilder::BuildLoadDoubleField(ValueNode* object,
+                                                    int offset) {
+  if (CanTrackObjectChanges(object, TrackObjectMode::kLoad)) {
+    VirtualObject* vobject =
+        GetObjectFromAllocation(object->Cast<InlinedAllocation>());
+    CHECK_EQ(vobject->type(), VirtualObject::kDefault);
+    // Double fields point to a HeapNumber box. Any store to the field would
+    // have escaped the object, so the box still holds its initial value, which
+    // we can use directly instead of materializing the object.
+    ValueNode* box = vobject->get(offset);
+    ValueNode* value = nullptr;
+    if (box->Is<Float64Constant>()) {
+      value = box;
+    } else if (InlinedAllocation* box_alloc =
+                   box->TryCast<InlinedAllocation>()) {
+      if (box_alloc->object()->type() == VirtualObject::kHeapNumber) {
+        value = GetFloat64Constant(box_alloc->object()->number());
+      }
+    }
+    if (value != nullptr) {
+      if (v8_flags.trace_maglev_object_tracking) {
+        std::cout << "  * Reusing double value in virtual object "
+                  << PrintNodeLabel(graph_labeller(), vobject) << "[" << offset
+                  << "]: " << PrintNode(graph_labeller(), value) << std::endl;
+      }
+      return value;
+    }
+  }
+  return AddNewNode<LoadDoubleField>({object}, offset);
+}
+
 ValueNode* MaglevGraphBuilder::BuildLoadFixedArrayLength(
     ValueNode* fixed_array) {
   ValueNode* length =
@@ -5420,10 +5451,71 @@ ReduceResult MaglevGraphBuilder::TryBuildCheckInt32Condition(
       return EmitUnconditionalDeopt(reason);
     }
   }
+  if (IsInt32ConditionKnownToHold(lhs, rhs, condition)) {
+    return ReduceResult::Done();
+  }
   AddNewNode<CheckInt32Condition>({lhs, rhs}, condition, reason);
+  RecordCheckedInt32Condition(lhs, rhs, condition);
   return ReduceResult::Done();
 }
 
+bool MaglevGraphBuilder::IsInt32ConditionKnownToHold(
+    ValueNode* lhs, ValueNode* rhs, AssertCondition condition) {
+  if (!v8_flags.maglev_bounds_check_elimination) return false;
+  auto& checked = known_node_aspects().checked_int32_conditions;
+  auto is_known = [&](AssertCondition c) {
+    return checked.count(std::tuple{lhs, rhs, c}) != 0;
+  };
+  // A strict comparison that was checked also implies the non-strict one.
+  bool known;
+  switch (condition) {
+    case AssertCondition::kLessThanEqual:
+      known = is_known(condition) || is_known(AssertCondition::kLessThan);
+      break;
+    case AssertCondition::kUnsignedLessThanEqual:
+      known = is_known(condition) ||
+              is_known(AssertCondition::kUnsignedLessThan);
+      break;
+    case AssertCondition::kGreaterThanEqual:
+      known = is_known(condition) || is_known(AssertCondition::kGreaterThan);
+      break;
+    case AssertCondition::kUnsignedGreaterThanEqual:
+      known = is_known(condition) ||
+              is_known(AssertCondition::kUnsignedGreaterThan);
+      break;
+    default:
+      known = is_known(condition);
+      break;
+  }
+  if (known && v8_flags.trace_maglev_graph_building) {
+    std::cout << "  * Eliminating check "
+              << PrintNodeLabel(graph_labeller(), lhs) << " " << condition
+              << " " << PrintNodeLabel(graph_labeller(), rhs)
+              << ", already checked in a dominator" << std::endl;
+  }
+  return known;
+}
+
+void MaglevGraphBuilder::RecordCheckedInt32Condition(
+    ValueNode* lhs, ValueNode* rhs, AssertCondition condition) {
+  if (!v8_flags.maglev_bounds_check_elimination) return;
+  known_node_aspects().checked_int32_conditions.emplace(lhs, rhs, condition);
+}
+
+void MaglevGraphBuilder::BuildCheckTypedArrayBounds(ValueNode* index,
+                                                    ValueNode* length) {
+  // CheckTypedArrayBounds is an unsigned index < length check, so it shares
+  // the known conditions with CheckInt32Condition. The inputs have different
+  // representations, so the keys never alias with actual int32 checks.
+  if (IsInt32ConditionKnownToHold(index, length,
+                                  AssertCondition::kUnsignedLessThan)) {
+    return;
+  }
+  AddNewNode<CheckTypedArrayBounds>({index, length});
+  RecordCheckedInt32Condition(index, length,
+                              AssertCondition::kUnsignedLessThan);
+}
+
 ValueNode* MaglevGraphBuilder::BuildLoadElements(ValueNode* object) {
   ReduceResult known_elements =
       TryFindLoadedProperty(known_node_aspects().loaded_properties, object,
@@ -5567,7 +5659,7 @@ ReduceResult MaglevGraphBuilder::TryBuildElementAccessOnTypedArray(
   ValueNode* length;
   GET_VALUE_OR_ABORT(index, GetUint32ElementIndex(index_object));
   GET_VALUE_OR_ABORT(length, BuildLoadTypedArrayLength(object, elements_kind));
-  AddNewNode<CheckTypedArrayBounds>({index, length});
+  BuildCheckTypedArrayBounds(index, length);
   switch (keyed_mode.access_mode()) {
     case compiler::AccessMode::kLoad:
       DCHECK(!LoadModeHandlesOOB(keyed_mode.load_mode()));
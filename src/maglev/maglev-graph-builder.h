@@ -2227,6 +2227,7 @@ class MaglevGraphBuilder {
   ValueNode* BuildLoadField(compiler::PropertyAccessInfo const& access_info,
                             ValueNode* lookup_start_object,
                             compiler::NameRef name);
+  ValueNode* BuildLoadDoubleField(ValueNode* object, int offset);
   ReduceResult TryBuildStoreField(
       compiler::PropertyAccessInfo const& access_info, ValueNode* receiver,
       compiler::AccessMode access_mode);
@@ -2251,6 +2252,11 @@ class MaglevGraphBuilder {
   ReduceResult TryBuildCheckInt32Condition(ValueNode* lhs, ValueNode* rhs,
                                            AssertCondition condition,
                                            DeoptimizeReason reason);
+  bool IsInt32ConditionKnownToHold(ValueNode* lhs, ValueNode* rhs,
+                                   AssertCondition condition);
+  void RecordCheckedInt32Condition(ValueNode* lhs, ValueNode* rhs,
+                                   AssertCondition condition);
+  void BuildCheckTypedArrayBounds(ValueNode* index, ValueNode* length);
 
   ReduceResult TryBuildPropertyLoad(
       ValueNode* receiver, ValueNode* lookup_start_object,
@@ -89,6 +89,8 @@ void KnownNodeAspects::Merge(const KnownNodeAspects& other, Zone* zone) {
     }
   }
   DestructivelyIntersect(loaded_context_slots, other.loaded_context_slots);
+  DestructivelyIntersect(checked_int32_conditions,
+                         other.checked_int32_conditions);
 }
 
 namespace {
@@ -178,6 +180,8 @@ KnownNodeAspects* KnownNodeAspects::CloneForLoopHeader(
   }
   clone->loaded_constant_properties = loaded_constant_properties;
   clone->loaded_context_constants = loaded_context_constants;
+  // Checks before the loop dominate the whole loop body.
+  clone->checked_int32_conditions = checked_int32_conditions;
 
   clone->effect_epoch_ = effect_epoch_;
   // To account for the back-jump we must not allow effects to be reshuffled
@@ -67,6 +67,27 @@ void DestructivelyIntersect(ZoneMap<Key, Value>& lhs_map,
   }
 }
 
+// Same as above, but for sets, where there are no values to merge.
+template <typename Key>
+void DestructivelyIntersect(ZoneSet<Key>& lhs_set,
+                            const ZoneSet<Key>& rhs_set) {
+  typename ZoneSet<Key>::iterator lhs_it = lhs_set.begin();
+  typename ZoneSet<Key>::const_iterator rhs_it = rhs_set.begin();
+  while (lhs_it != lhs_set.end() && rhs_it != rhs_set.end()) {
+    if (*lhs_it < *rhs_it) {
+      lhs_it = lhs_set.erase(lhs_it);
+    } else if (*rhs_it < *lhs_it) {
+      ++rhs_it;
+    } else {
+      ++lhs_it;
+      ++rhs_it;
+    }
+  }
+  if (lhs_it != lhs_set.end()) {
+    lhs_set.erase(lhs_it, lhs_set.end());
+  }
+}
+
 using PossibleMaps = compiler::ZoneRefSet<Map>;
 
 class NodeInfo {
@@ -270,6 +291,7 @@ struct KnownNodeAspects {
         loaded_properties(zone),
         loaded_context_constants(zone),
         loaded_context_slots(zone),
+        checked_int32_conditions(zone),
         available_expressions(zone),
         node_infos(zone),
         effect_epoch_(0) {}
@@ -474,6 +496,12 @@ struct KnownNodeAspects {
   using LoadedContextSlots = ZoneMap<LoadedContextSlotsKey, ValueNode*>;
   LoadedContextSlots loaded_context_slots;
 
+  // Int32 conditions guarded by a deopting check. Since the inputs are SSA
+  // values, these are permanently valid if checked in a dominator.
+  using CheckedInt32ConditionKey =
+      std::tuple<ValueNode*, ValueNode*, AssertCondition>;
+  ZoneSet<CheckedInt32ConditionKey> checked_int32_conditions;
+
   struct AvailableExpression {
     NodeBase* node;
     uint32_t effect_epoch;
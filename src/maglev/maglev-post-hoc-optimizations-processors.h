@@ -18,7 +18,7 @@
 namespace v8::internal::maglev {
 
 // Optimizations involving loops which cannot be done at graph building time.
-// Currently mainly loop invariant code motion.
+// Currently mainly loop invariant code motion of loads and checks.
 class LoopOptimizationProcessor {
  public:
   explicit LoopOptimizationProcessor(MaglevGraphBuilder* builder)
@@ -54,10 +54,7 @@ class LoopOptimizationProcessor {
   }
 
   bool CanHoist(Node* candidate) {
-    DCHECK_EQ(candidate->input_count(), 1);
     DCHECK(current_block->is_loop());
-    ValueNode* input = candidate->input(0).node();
-    DCHECK(!IsLoopPhi(input));
     // For hoisting an instruction we need:
     // * A unique loop entry block.
     // * Inputs live before the loop (i.e., not defined inside the loop).
@@ -69,8 +66,13 @@ class LoopOptimizationProcessor {
     if (loop_entry->successors().size() != 1) {
       return false;
     }
-    if (IsConstantNode(input->opcode())) return true;
-    return input->owner() != current_block;
+    for (Input& input : *candidate) {
+      ValueNode* node = input.node();
+      DCHECK(!IsLoopPhi(node));
+      if (IsConstantNode(node->opcode())) continue;
+      if (node->owner() == current_block) return false;
+    }
+    return true;
   }
 
   ProcessResult Process(LoadTaggedFieldForContextSlot* ltf,
@@ -124,22 +126,52 @@ class LoopOptimizationProcessor {
 
   ProcessResult Process(CheckMaps* maps, const ProcessingState& state) {
     DCHECK(loop_effects);
-    // Conservatively not hoist map checks if we ever deoptimized this function
+    if (loop_effects->unstable_aspects_cleared) {
+      return ProcessResult::kContinue;
+    }
+    return TryHoistCheck(maps);
+  }
+
+  // Int32 conditions only depend on their inputs and are not invalidated by
+  // side-effects in the loop.
+  ProcessResult Process(CheckInt32Condition* check,
+                        const ProcessingState& state) {
+    DCHECK(loop_effects);
+    return TryHoistBoundsCheck(check);
+  }
+
+  ProcessResult Process(CheckTypedArrayBounds* check,
+                        const ProcessingState& state) {
+    DCHECK(loop_effects);
+    return TryHoistBoundsCheck(check);
+  }
+
+  ProcessResult TryHoistBoundsCheck(Node* check) {
+    if (v8_flags.maglev_bounds_check_elimination &&
+        TryHoistCheck(check) == ProcessResult::kHoist) {
+      return ProcessResult::kHoist;
+    }
+    // A check that stays in the loop must not be hoisted over, like in the
+    // generic case below.
+    loop_effects = nullptr;
+    return ProcessResult::kSkipBlock;
+  }
+
+  ProcessResult TryHoistCheck(Node* check) {
+    // Conservatively not hoist checks if we ever deoptimized this function
     // to avoid deopt loops.
     if (was_deoptimized) return ProcessResult::kContinue;
-    ValueNode* object = maps->receiver_input().node();
-    if (IsLoopPhi(object)) {
-      return ProcessResult::kContinue;
+    for (Input& input : *check) {
+      if (IsLoopPhi(input.node())) return ProcessResult::kContinue;
     }
-    if (!loop_effects->unstable_aspects_cleared && CanHoist(maps)) {
-      if (auto j = current_block->predecessor_at(0)
-                       ->control_node()
-                       ->TryCast<CheckpointedJump>()) {
-        maps->SetEagerDeoptInfo(zone, j->eager_deopt_info()->top_frame(),
-                                maps->eager_deopt_info()->feedback_to_update());
-      } else {
-        return ProcessResult::kContinue;
-      }
+    if (!CanHoist(check)) return ProcessResult::kContinue;
+    // The hoisted check deopts to the frame state before entering the loop.
+    if (auto j = current_block->predecessor_at(0)
+                     ->control_node()
+                     ->TryCast<CheckpointedJump>()) {
+      check->SetEagerDeoptInfo(
+          zone, j->eager_deopt_info()->top_frame(),
+          check->eager_deopt_info()->feedback_to_update());
       return ProcessResult::kHoist;
     }
     return ProcessResult::kContinue;
@@ -108,6 +108,81 @@ void RecordStatus(Isolate* isolate, AllocationStatus status) {
       static_cast<int>(status));
 }
 
+#if V8_ENABLE_WEBASSEMBLY
+// Keeps the reservations of freed Wasm memories (including their guard
+// regions) for reuse, so that short-lived instances do not have to map and
+// unmap a full reservation on each instantiation. The size of the pool is
+// limited by --wasm-memory-pool-size.
+// Pooled reservations are fully decommitted, so their memory is inaccessible
+// and reads as zero once it gets committed again.
+class WasmMemoryReservationPool {
+ public:
+  // Returns the start of a pooled reservation of {reservation_size} bytes, or
+  // nullptr if there is none.
+  void* TryTake(size_t reservation_size, bool has_guard_regions) {
+    base::MutexGuard guard(&mutex_);
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+      if (it->reservation_size != reservation_size ||
+          it->has_guard_regions != has_guard_regions) {
+        continue;
+      }
+      void* allocation_base = it->allocation_base;
+      entries_.erase(it);
+      return allocation_base;
+    }
+    return nullptr;
+  }
+
+  // Decommits the first {committed_size} bytes of the reservation and adds it
+  // to the pool. Returns false if the reservation was not pooled; the caller
+  // then still owns it.
+  bool TryPut(void* allocation_base, size_t reservation_size,
+              bool has_guard_regions, size_t committed_size) {
+    if (!HasCapacity()) return false;
+    if (committed_size != 0 &&
+        !GetArrayBufferPageAllocator()->DecommitPages(allocation_base,
+                                                      committed_size)) {
+      return false;
+    }
+    base::MutexGuard guard(&mutex_);
+    if (entries_.size() >= v8_flags.wasm_memory_pool_size) return false;
+    entries_.push_back({allocation_base, reservation_size, has_guard_regions});
+    return true;
+  }
+
+  // Releases all pooled reservations.
+  void Flush() {
+    std::vector<Entry> entries;
+    {
+      base::MutexGuard guard(&mutex_);
+      entries.swap(entries_);
+    }
+    for (const Entry& entry : entries) {
+      FreePages(GetArrayBufferPageAllocator(), entry.allocation_base,
+                entry.reservation_size);
+    }
+  }
+
+ private:
+  struct Entry {
+    void* allocation_base;
+    size_t reservation_size;
+    bool has_guard_regions;
+  };
+
+  bool HasCapacity() {
+    base::MutexGuard guard(&mutex_);
+    return entries_.size() < v8_flags.wasm_memory_pool_size;
+  }
+
+  base::Mutex mutex_;
+  std::vector<Entry> entries_;
+};
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(WasmMemoryReservationPool,
+                                GetWasmMemoryReservationPool)
+#endif  // V8_ENABLE_WEBASSEMBLY
+
 }  // namespace
 
 // The backing store for a Wasm shared memory remembers all the isolates
@@ -192,6 +267,13 @@ BackingStore::~BackingStore() {
       // Deallocate the list of attached memory objects.
       SharedWasmMemoryData* shared_data = get_shared_wasm_memory_data();
       delete shared_data;
+    } else if (v8_flags.wasm_memory_pool_size > 0 &&
+               GetWasmMemoryReservationPool()->TryPut(
+                   buffer_start_, reservation_size, has_guard_regions_,
+                   byte_length())) {
+      TRACE_BS("BSw:pool  bs=%p mem=%p (reservation=%zu)\n", this,
+               buffer_start_, reservation_size);
+      return;
     }
     // Wasm memories are always allocated through the page allocator.
     FreeResizableMemory();
@@ -343,8 +425,23 @@ std::unique_ptr<BackingStore> BackingStore::TryAllocateAndPartiallyCommitMemory(
   void* allocation_base = nullptr;
   PageAllocator* page_allocator = GetArrayBufferPageAllocator();
   auto allocate_pages = [&] {
+#if V8_ENABLE_WEBASSEMBLY
+    if (wasm_memory != WasmMemoryFlag::kNotWasm &&
+        v8_flags.wasm_memory_pool_size > 0) {
+      allocation_base = GetWasmMemoryReservationPool()->TryTake(
+          reservation_size, guards);
+      if (allocation_base != nullptr) {
+        TRACE_BS("BSw:try   reusing pooled reservation %p\n", allocation_base);
+        return true;
+      }
+    }
+#endif  // V8_ENABLE_WEBASSEMBLY
     allocation_base = AllocatePages(page_allocator, nullptr, reservation_size,
                                     page_size, PageAllocator::kNoAccess);
+#if V8_ENABLE_WEBASSEMBLY
+    // Give the address space of pooled reservations back before retrying.
+    if (allocation_base == nullptr) BackingStore::FlushWasmMemoryPool();
+#endif  // V8_ENABLE_WEBASSEMBLY
     return allocation_base != nullptr;
   };
   if (!gc_retry(allocate_pages)) {
@@ -445,6 +542,11 @@ std::unique_ptr<BackingStore> BackingStore::AllocateWasmMemory(
   return backing_store;
 }
 
+// static
+void BackingStore::FlushWasmMemoryPool() {
+  GetWasmMemoryReservationPool()->Flush();
+}
+
 std::unique_ptr<BackingStore> BackingStore::CopyWasmMemory(
     Isolate* isolate, size_t new_pages, size_t max_pages,
     WasmMemoryFlag wasm_memory) {
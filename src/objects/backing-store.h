@@ -137,6 +137,10 @@ class V8_EXPORT_PRIVATE BackingStore : public BackingStoreBase {
 
   // Update all shared memory objects in this isolate (after a grow operation).
   static void UpdateSharedWasmMemoryObjects(Isolate* isolate);
+
+  // Release all Wasm memory reservations kept for reuse (see
+  // --wasm-memory-pool-size).
+  static void FlushWasmMemoryPool();
 #endif  // V8_ENABLE_WEBASSEMBLY
 
   // Returns the size of the external memory owned by this backing store.
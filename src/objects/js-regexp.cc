@@ -371,13 +371,21 @@ bool RegExpData::HasCompiledCode() const {
   return re_data->has_latin1_code() || re_data->has_uc16_code();
 }
 
-// Only irregexps are subject to tier-up.
+// Irregexps tier up from bytecode to native code, experimental regexps from
+// the experimental interpreter to native irregexp code.
 bool IrRegExpData::CanTierUp() {
-  return v8_flags.regexp_tier_up && type_tag() == Type::IRREGEXP;
+  switch (type_tag()) {
+    case Type::IRREGEXP:
+      return v8_flags.regexp_tier_up;
+    case Type::EXPERIMENTAL:
+      return v8_flags.experimental_regexp_engine_tier_up;
+    default:
+      return false;
+  }
 }
 
-// An irregexp is considered to be marked for tier up if the tier-up ticks
-// value reaches zero.
+// A regexp is considered to be marked for tier up if the tier-up ticks value
+// reaches zero.
 bool IrRegExpData::MarkedForTierUp() {
   if (!CanTierUp()) {
     return false;
@@ -394,7 +402,7 @@ void IrRegExpData::ResetLastTierUpTick() {
 
 void IrRegExpData::TierUpTick() {
   int tier_up_ticks = ticks_until_tier_up();
-  if (tier_up_ticks == 0) {
+  if (tier_up_ticks <= 0) {
     return;
   }
 
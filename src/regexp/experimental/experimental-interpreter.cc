@@ -4,16 +4,22 @@
 
 #include "src/regexp/experimental/experimental-interpreter.h"
 
+#include <algorithm>
+#include <map>
+#include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "src/base/strings.h"
 #include "src/common/assert-scope.h"
+#include "src/execution/isolate.h"
 #include "src/flags/flags.h"
 #include "src/objects/fixed-array-inl.h"
 #include "src/objects/string-inl.h"
 #include "src/regexp/experimental/experimental.h"
 #include "src/strings/char-predicates-inl.h"
+#include "src/utils/ostreams.h"
 #include "src/zone/zone-allocator.h"
 #include "src/zone/zone-list-inl.h"
 
@@ -225,6 +231,230 @@ class FilterGroups {
   base::Vector<const RegExpInstruction> bytecode_;
 };
 
+}  // namespace
+
+// A DFA that is constructed lazily while matching, by simulating the bytecode
+// without registers.  States are sets of threads blocked on a CONSUME_RANGE
+// instruction, ordered by priority exactly like the blocked threads of the
+// `NfaInterpreter`, so the DFA finds a match if and only if the NFA does.  A
+// thread is identified by its pc and whether it consumed a character since it
+// last entered a quantifier.
+//
+// The DFA does not know where a match starts or which groups it captures, so
+// it is only used to find out whether there is a match at all.  Since most
+// positions of the input typically don't start a match, this skips the
+// expensive thread management of the NFA for them.
+//
+// Assertions and lookbehinds depend on the context of the current position
+// and are not supported.  The number of states is bounded by
+// --experimental-regexp-engine-dfa-max-states; once that is exceeded the
+// NFA is used instead.  DFAs are kept across executions by the
+// `ExperimentalRegExpDfaCache` of the isolate.
+class LazyDfa {
+ public:
+  static constexpr int kCacheFull = -1;
+
+  static bool CanHandle(base::Vector<const RegExpInstruction> bytecode) {
+    for (const RegExpInstruction& inst : bytecode) {
+      switch (inst.opcode) {
+        case RegExpInstruction::ASSERTION:
+        case RegExpInstruction::WRITE_LOOKBEHIND_TABLE:
+        case RegExpInstruction::READ_LOOKBEHIND_TABLE:
+          return false;
+        default:
+          break;
+      }
+    }
+    return true;
+  }
+
+  explicit LazyDfa(base::Vector<const RegExpInstruction> bytecode)
+      : visited_(2 * bytecode.size(), 0) {
+    // Characters that are contained in the same CONSUME_RANGE instructions
+    // lead to the same transitions, so only one transition per class of such
+    // characters is stored.
+    for (const RegExpInstruction& inst : bytecode) {
+      if (inst.opcode != RegExpInstruction::CONSUME_RANGE) continue;
+      RegExpInstruction::Uc16Range range = inst.payload.consume_range;
+      if (range.min > range.max) continue;
+      boundaries_.push_back(range.min);
+      boundaries_.push_back(range.max + 1);
+    }
+    std::sort(boundaries_.begin(), boundaries_.end());
+    boundaries_.erase(std::unique(boundaries_.begin(), boundaries_.end()),
+                      boundaries_.end());
+    class_count_ = static_cast<int>(boundaries_.size()) + 1;
+    for (int c = 0; c < kOneByteClassCount; ++c) {
+      one_byte_classes_[c] = ComputeClass(c);
+    }
+  }
+
+  // Returns the state of the DFA before consuming any input, or kCacheFull.
+  int StartState(base::Vector<const RegExpInstruction> bytecode) {
+    if (start_state_ == kUnknown) {
+      std::vector<uint32_t> threads = {
+          Encode(0, ConsumedCharacter::kDidConsume)};
+      start_state_ = Closure(threads, bytecode);
+    }
+    return start_state_;
+  }
+
+  // Returns the state after consuming {c} in {state}, or kCacheFull.
+  int Next(int state, base::uc16 c,
+           base::Vector<const RegExpInstruction> bytecode) {
+    DCHECK_LE(0, state);
+    const int char_class = c < kOneByteClassCount ? one_byte_classes_[c]
+                                                  : ComputeClass(c);
+    const size_t index = static_cast<size_t>(state) * class_count_ + char_class;
+    if (transitions_[index] != kUnknown) return transitions_[index];
+
+    std::vector<uint32_t> threads;
+    for (uint32_t thread : states_[state].threads) {
+      int pc = PcOf(thread);
+      RegExpInstruction::Uc16Range range = bytecode[pc].payload.consume_range;
+      if (c >= range.min && c <= range.max) {
+        threads.push_back(Encode(pc + 1, ConsumedCharacter::kDidConsume));
+      }
+    }
+    int next = Closure(threads, bytecode);
+    // {transitions_} may have been resized.
+    transitions_[index] = next;
+    return next;
+  }
+
+  // Whether the NFA would have found a match when reaching {state}.
+  bool IsMatch(int state) const { return states_[state].is_match; }
+  // Whether no thread is left in {state}.
+  bool IsDead(int state) const { return states_[state].threads.empty(); }
+  // Whether a state was needed beyond the maximum number of states.
+  bool overflowed() const { return overflowed_; }
+
+ private:
+  enum class ConsumedCharacter { kDidNotConsume = 0, kDidConsume = 1 };
+
+  static constexpr int kUnknown = -2;
+  static constexpr int kOneByteClassCount = 256;
+
+  struct State {
+    std::vector<uint32_t> threads;
+    bool is_match;
+  };
+
+  static uint32_t Encode(int pc, ConsumedCharacter consumed) {
+    return (static_cast<uint32_t>(pc) << 1) | static_cast<uint32_t>(consumed);
+  }
+  static int PcOf(uint32_t thread) { return static_cast<int>(thread >> 1); }
+  static ConsumedCharacter ConsumedOf(uint32_t thread) {
+    return static_cast<ConsumedCharacter>(thread & 1);
+  }
+
+  int ComputeClass(int c) const {
+    return static_cast<int>(
+        std::upper_bound(boundaries_.begin(), boundaries_.end(), c) -
+        boundaries_.begin());
+  }
+
+  // Runs the {threads} (ordered from high to low priority) until they block
+  // or die, the way `NfaInterpreter::RunActiveThreads` does, and returns the
+  // resulting state or kCacheFull.
+  int Closure(const std::vector<uint32_t>& threads,
+              base::Vector<const RegExpInstruction> bytecode) {
+    if (++stamp_ == 0) {
+      std::fill(visited_.begin(), visited_.end(), 0);
+      stamp_ = 1;
+    }
+    State result{{}, false};
+    std::vector<uint32_t> forks;
+    for (uint32_t thread : threads) {
+      forks.push_back(thread);
+      while (!forks.empty() && !result.is_match) {
+        uint32_t t = forks.back();
+        forks.pop_back();
+        int pc = PcOf(t);
+        ConsumedCharacter consumed = ConsumedOf(t);
+        bool done = false;
+        while (!done) {
+          SBXCHECK_BOUNDS(pc, bytecode.size());
+          const uint32_t key = Encode(pc, consumed);
+          if (visited_[key] == stamp_) break;
+          visited_[key] = stamp_;
+          const RegExpInstruction& inst = bytecode[pc];
+          switch (inst.opcode) {
+            case RegExpInstruction::CONSUME_RANGE:
+              result.threads.push_back(key);
+              done = true;
+              break;
+            case RegExpInstruction::FORK:
+              forks.push_back(Encode(inst.payload.pc, consumed));
+              ++pc;
+              break;
+            case RegExpInstruction::JMP:
+              pc = inst.payload.pc;
+              break;
+            case RegExpInstruction::ACCEPT:
+              // Threads with lower priority can only produce worse matches.
+              result.is_match = true;
+              forks.clear();
+              done = true;
+              break;
+            case RegExpInstruction::SET_REGISTER_TO_CP:
+            case RegExpInstruction::CLEAR_REGISTER:
+            case RegExpInstruction::SET_QUANTIFIER_TO_CLOCK:
+              ++pc;
+              break;
+            case RegExpInstruction::BEGIN_LOOP:
+              consumed = ConsumedCharacter::kDidNotConsume;
+              ++pc;
+              break;
+            case RegExpInstruction::END_LOOP:
+              if (consumed == ConsumedCharacter::kDidNotConsume) {
+                done = true;
+              } else {
+                ++pc;
+              }
+              break;
+            default:
+              UNREACHABLE();
+          }
+        }
+      }
+      if (result.is_match) break;
+    }
+
+    auto it = state_ids_.find({result.threads, result.is_match});
+    if (it != state_ids_.end()) return it->second;
+    if (states_.size() >= v8_flags.experimental_regexp_engine_dfa_max_states) {
+      overflowed_ = true;
+      return kCacheFull;
+    }
+    int id = static_cast<int>(states_.size());
+    state_ids_.emplace(std::make_pair(result.threads, result.is_match), id);
+    states_.push_back(std::move(result));
+    transitions_.resize(states_.size() * class_count_, kUnknown);
+    return id;
+  }
+
+  // Sorted boundaries of the character classes: class i contains the
+  // characters in [boundaries_[i - 1], boundaries_[i]).
+  std::vector<int> boundaries_;
+  int class_count_;
+  uint16_t one_byte_classes_[kOneByteClassCount];
+
+  std::vector<State> states_;
+  std::map<std::pair<std::vector<uint32_t>, bool>, int> state_ids_;
+  // transitions_[state * class_count_ + class] is the next state, kUnknown or
+  // kCacheFull.
+  std::vector<int> transitions_;
+  int start_state_ = kUnknown;
+  bool overflowed_ = false;
+
+  // Threads visited by the current call to `Closure`, marked with `stamp_`.
+  std::vector<uint32_t> visited_;
+  uint32_t stamp_ = 0;
+};
+
+namespace {
+
 template <class Character>
 class NfaInterpreter {
   // Executes a bytecode program in breadth-first mode, without backtracking.
@@ -279,19 +509,46 @@ class NfaInterpreter {
                  Tagged<TrustedByteArray> bytecode,
                  int register_count_per_match, Tagged<String> input,
                  int32_t input_index, Zone* zone)
+      : NfaInterpreter(
+            isolate, call_origin, bytecode,
+            ToInstructionVector(bytecode, DisallowGarbageCollection()),
+            register_count_per_match, input,
+            ToCharacterVector<Character>(input, DisallowGarbageCollection()),
+            input_index, input->length() + 1, zone) {}
+
+  // Creates an interpreter that neither accesses the heap nor the isolate, so
+  // that it can run on any thread.  Interrupts are not handled.  Matches
+  // starting at or after `match_start_limit` are not reported.
+  NfaInterpreter(base::Vector<const RegExpInstruction> bytecode,
+                 int register_count_per_match,
+                 base::Vector<const Character> input, int32_t input_index,
+                 int32_t match_start_limit, Zone* zone)
+      : NfaInterpreter(nullptr, RegExp::CallOrigin::kFromRuntime,
+                       Tagged<TrustedByteArray>(), bytecode,
+                       register_count_per_match, Tagged<String>(), input,
+                       input_index, match_start_limit, zone) {}
+
+ private:
+  NfaInterpreter(Isolate* isolate, RegExp::CallOrigin call_origin,
+                 Tagged<TrustedByteArray> bytecode_object,
+                 base::Vector<const RegExpInstruction> bytecode,
+                 int register_count_per_match, Tagged<String> input_object,
+                 base::Vector<const Character> input, int32_t input_index,
+                 int32_t match_start_limit, Zone* zone)
       : isolate_(isolate),
         call_origin_(call_origin),
-        bytecode_object_(bytecode),
-        bytecode_(ToInstructionVector(bytecode, no_gc_)),
+        bytecode_object_(bytecode_object),
+        bytecode_(bytecode),
         register_count_per_match_(register_count_per_match),
         quantifier_count_(0),
-        input_object_(input),
-        input_(ToCharacterVector<Character>(input, no_gc_)),
+        input_object_(input_object),
+        input_(input),
         input_index_(input_index),
+        match_start_limit_(match_start_limit),
         clock(0),
         pc_last_input_index_(
-            zone->AllocateArray<LastInputIndex>(bytecode->length()),
-            bytecode->length()),
+            zone->AllocateArray<LastInputIndex>(bytecode.length()),
+            bytecode.length()),
         active_threads_(0, zone),
         blocked_threads_(0, zone),
         register_array_allocator_(zone),
@@ -357,8 +614,17 @@ class NfaInterpreter {
 
     std::fill(pc_last_input_index_.begin(), pc_last_input_index_.end(),
               LastInputIndex());
+
+    if (v8_flags.experimental_regexp_engine_lazy_dfa &&
+        lookbehind_pc_.is_empty() && LazyDfa::CanHandle(bytecode_)) {
+      // Interpreters off the main thread can't share the DFA of the isolate.
+      dfa_ = isolate_ != nullptr
+                 ? isolate_->experimental_regexp_dfa_cache()->Get(bytecode_)
+                 : std::make_shared<LazyDfa>(bytecode_);
+    }
   }
 
+ public:
   // Finds matches and writes their concatenated capture registers to
   // `output_registers`.  `output_registers[i]` has to be valid for all i <
   // output_register_count.  The search continues until all remaining matches
@@ -368,7 +634,14 @@ class NfaInterpreter {
     const int max_match_num = output_register_count / register_count_per_match_;
 
     int match_num = 0;
-    while (match_num != max_match_num) {
+    while (match_num != max_match_num && input_index_ < match_start_limit_) {
+      if (dfa_) {
+        bool may_match;
+        int err_code = RunDfa(&may_match);
+        if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
+        if (!may_match) break;
+      }
+
       int err_code = FindNextMatch();
       if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
 
@@ -448,6 +721,9 @@ class NfaInterpreter {
   // RegExp::kInternalRegExpSuccess if execution can continue, and an error
   // code otherwise.
   int HandleInterrupts() {
+    // Interpreters running off the main thread have no isolate.
+    if (isolate_ == nullptr) return RegExp::kInternalRegExpSuccess;
+
     StackLimitCheck check(isolate_);
     if (call_origin_ == RegExp::CallOrigin::kFromJs) {
       // Direct calls from JavaScript can be interrupted in two ways:
@@ -508,6 +784,45 @@ class NfaInterpreter {
     return RegExp::kInternalRegExpSuccess;
   }
 
+  // Runs the lazy DFA from the current input index to find out whether
+  // `FindNextMatch` would find a match.  Sets `may_match` to false only if
+  // there is no match.  If the DFA exceeds its maximum number of states, it
+  // is discarded and `may_match` is set to true.
+  int RunDfa(bool* may_match) {
+    DCHECK(dfa_);
+    *may_match = true;
+    int index = input_index_;
+    int state = dfa_->StartState(bytecode_);
+    while (state != LazyDfa::kCacheFull) {
+      // The NFA computes where the match starts and ends, so the DFA only has
+      // to find out whether there is one.
+      if (dfa_->IsMatch(state)) return RegExp::kInternalRegExpSuccess;
+      if (dfa_->IsDead(state) || index == input_.length()) {
+        *may_match = false;
+        return RegExp::kInternalRegExpSuccess;
+      }
+      // A match starting before the limit may still end after it, which the
+      // DFA can't tell apart from one starting after the limit.
+      if (index >= match_start_limit_) return RegExp::kInternalRegExpSuccess;
+      state = dfa_->Next(state, input_[index], bytecode_);
+      ++index;
+
+      static constexpr int kTicksBetweenInterruptHandling = 64;
+      if (index % kTicksBetweenInterruptHandling == 0) {
+        int err_code = HandleInterrupts();
+        if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
+      }
+    }
+
+    if (v8_flags.trace_experimental_regexp_engine) {
+      StdoutStream{} << "Lazy DFA exceeded "
+                     << v8_flags.experimental_regexp_engine_dfa_max_states
+                     << " states, falling back to NFA" << std::endl;
+    }
+    dfa_.reset();
+    return RegExp::kInternalRegExpSuccess;
+  }
+
   // Change the current input index for future calls to `FindNextMatch`.
   void SetInputIndex(int new_input_index) {
     DCHECK_GE(input_index_, 0);
@@ -577,8 +892,9 @@ class NfaInterpreter {
     //   Threads with low priority have been aborted earlier, and the remaining
     //   threads are blocked here, so the latter simply means that
     //   `blocked_threads_` is empty.
-    while (input_index_ != input_.length() &&
-           !(FoundMatch() && blocked_threads_.is_empty())) {
+    // - There are no threads left that could produce a match, which can
+    //   happen once `match_start_limit_` is reached.
+    while (input_index_ != input_.length() && !blocked_threads_.is_empty()) {
       DCHECK(active_threads_.is_empty());
       base::uc16 input_char = input_[input_index_];
       ++input_index_;
@@ -790,7 +1106,12 @@ class NfaInterpreter {
       RegExpInstruction inst = bytecode_[t.pc];
       DCHECK_EQ(inst.opcode, RegExpInstruction::CONSUME_RANGE);
       RegExpInstruction::Uc16Range range = inst.payload.consume_range;
-      if (input_char >= range.min && input_char <= range.max) {
+      if (input_index_ >= match_start_limit_ &&
+          GetRegisterArray(t)[0] == kUndefinedRegisterValue) {
+        // The thread is still in the /.*?/ preamble, so any match it finds
+        // would start after the limit.
+        DestroyThread(t);
+      } else if (input_char >= range.min && input_char <= range.max) {
         ++t.pc;
         t.consumed_since_last_quantifier =
             InterpreterThread::ConsumedCharacter::DidConsume;
@@ -1030,6 +1351,9 @@ class NfaInterpreter {
   base::Vector<const Character> input_;
   int input_index_;
 
+  // Matches must start before this index.
+  const int match_start_limit_;
+
   // Global clock counting the total of executed instructions.
   uint64_t clock;
 
@@ -1091,6 +1415,11 @@ class NfaInterpreter {
 
   uint64_t memory_consumption_per_thread_;
 
+  // Used to skip searches that don't find a match, if the bytecode can be
+  // handled by a DFA.  Shared with other executions through the isolate's
+  // `ExperimentalRegExpDfaCache`.
+  std::shared_ptr<LazyDfa> dfa_;
+
   Zone* zone_;
 };
 
@@ -1118,5 +1447,60 @@ int ExperimentalRegExpInterpreter::FindMatches(
   }
 }
 
+int ExperimentalRegExpInterpreter::FindMatches(
+    base::Vector<const RegExpInstruction> bytecode,
+    int register_count_per_match, base::Vector<const uint8_t> input,
+    int start_index, int match_start_limit, int32_t* output_registers,
+    int output_register_count, Zone* zone) {
+  NfaInterpreter<uint8_t> interpreter(bytecode, register_count_per_match,
+                                      input, start_index, match_start_limit,
+                                      zone);
+  return interpreter.FindMatches(output_registers, output_register_count);
+}
+
+int ExperimentalRegExpInterpreter::FindMatches(
+    base::Vector<const RegExpInstruction> bytecode,
+    int register_count_per_match, base::Vector<const base::uc16> input,
+    int start_index, int match_start_limit, int32_t* output_registers,
+    int output_register_count, Zone* zone) {
+  NfaInterpreter<base::uc16> interpreter(bytecode, register_count_per_match,
+                                         input, start_index,
+                                         match_start_limit, zone);
+  return interpreter.FindMatches(output_registers, output_register_count);
+}
+
+struct ExperimentalRegExpDfaCache::Entry {
+  std::vector<RegExpInstruction> bytecode;
+  std::shared_ptr<LazyDfa> dfa;
+};
+
+ExperimentalRegExpDfaCache::ExperimentalRegExpDfaCache() = default;
+ExperimentalRegExpDfaCache::~ExperimentalRegExpDfaCache() = default;
+
+std::shared_ptr<LazyDfa> ExperimentalRegExpDfaCache::Get(
+    base::Vector<const RegExpInstruction> bytecode) {
+  DCHECK(LazyDfa::CanHandle(bytecode));
+  auto it = std::find_if(
+      entries_.begin(), entries_.end(), [&](const Entry& entry) {
+        return entry.bytecode.size() == bytecode.size() &&
+               memcmp(entry.bytecode.data(), bytecode.begin(),
+                      bytecode.size() * sizeof(RegExpInstruction)) == 0;
+      });
+  if (it == entries_.end()) {
+    if (entries_.size() == kMaxEntries) entries_.pop_back();
+    entries_.insert(entries_.begin(),
+                    {{bytecode.begin(), bytecode.end()},
+                     std::make_shared<LazyDfa>(bytecode)});
+  } else {
+    std::rotate(entries_.begin(), it, it + 1);
+  }
+  // Running into the maximum number of states again would waste the time
+  // spent in the DFA.
+  if (entries_.front().dfa->overflowed()) return nullptr;
+  return entries_.front().dfa;
+}
+
+void ExperimentalRegExpDfaCache::Clear() { entries_.clear(); }
+
 }  // namespace internal
 }  // namespace v8
@@ -5,12 +5,16 @@
 #ifndef V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_INTERPRETER_H_
 #define V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_INTERPRETER_H_
 
+#include <memory>
+#include <vector>
+
 #include "src/regexp/experimental/experimental-bytecode.h"
 #include "src/regexp/regexp.h"
 
 namespace v8 {
 namespace internal {
 
+class LazyDfa;
 class TrustedByteArray;
 class String;
 class Zone;
@@ -28,6 +32,48 @@ class ExperimentalRegExpInterpreter final : public AllStatic {
                          Tagged<String> input, int start_index,
                          int32_t* output_registers, int output_register_count,
                          Zone* zone);
+
+  // Variants that neither access the heap nor the isolate and can thus run on
+  // any thread.  They are not interruptible, and only report matches that
+  // start before `match_start_limit`.
+  static int FindMatches(base::Vector<const RegExpInstruction> bytecode,
+                         int register_count_per_match,
+                         base::Vector<const uint8_t> input, int start_index,
+                         int match_start_limit, int32_t* output_registers,
+                         int output_register_count, Zone* zone);
+  static int FindMatches(base::Vector<const RegExpInstruction> bytecode,
+                         int register_count_per_match,
+                         base::Vector<const base::uc16> input, int start_index,
+                         int match_start_limit, int32_t* output_registers,
+                         int output_register_count, Zone* zone);
+};
+
+// Keeps the lazy DFAs of the interpreter alive across executions, so that the
+// states and transitions computed by one execution are reused by the next
+// ones.  DFAs are keyed by the bytecode they were built for.  The cache holds
+// up to kMaxEntries DFAs of at most
+// --experimental-regexp-engine-dfa-max-states states each and evicts the least
+// recently used one.  Owned by the isolate and only used on its thread.
+class ExperimentalRegExpDfaCache final {
+ public:
+  static constexpr size_t kMaxEntries = 16;
+
+  ExperimentalRegExpDfaCache();
+  ~ExperimentalRegExpDfaCache();
+  ExperimentalRegExpDfaCache(const ExperimentalRegExpDfaCache&) = delete;
+  ExperimentalRegExpDfaCache& operator=(const ExperimentalRegExpDfaCache&) =
+      delete;
+
+  // Returns the DFA for `bytecode`, or nullptr if it exceeded the maximum
+  // number of states before.  The bytecode has to be supported by the DFA.
+  std::shared_ptr<LazyDfa> Get(base::Vector<const RegExpInstruction> bytecode);
+
+  void Clear();
+
+ private:
+  struct Entry;
+  // Ordered from most to least recently used.
+  std::vector<Entry> entries_;
 };
 
 }  // namespace internal
@@ -4,9 +4,17 @@
 
 #include "src/regexp/experimental/experimental.h"
 
+#include <atomic>
 #include <optional>
+#include <vector>
 
+#include "include/v8-platform.h"
+#include "src/builtins/builtins.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
 #include "src/common/assert-scope.h"
+#include "src/execution/isolate.h"
+#include "src/init/v8.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/regexp/experimental/experimental-compiler.h"
 #include "src/regexp/experimental/experimental-interpreter.h"
@@ -17,8 +25,6 @@ namespace v8::internal {
 
 bool ExperimentalRegExp::CanBeHandled(RegExpTree* tree, Handle<String> pattern,
                                       RegExpFlags flags, int capture_count) {
-  DCHECK(v8_flags.enable_experimental_regexp_engine ||
-         v8_flags.enable_experimental_regexp_engine_on_excessive_backtracks);
   bool can_be_handled =
       ExperimentalRegExpCompiler::CanBeHandled(tree, flags, capture_count);
   if (!can_be_handled && v8_flags.trace_experimental_regexp_engine) {
@@ -186,6 +192,8 @@ int32_t ExperimentalRegExp::ExecRaw(Isolate* isolate,
   static constexpr bool kIsLatin1 = true;
   Tagged<TrustedByteArray> bytecode = regexp_data->bytecode(kIsLatin1);
 
+  regexp_data->TierUpTick();
+
   return ExecRawImpl(isolate, call_origin, bytecode, subject,
                      regexp_data->capture_count(), output_registers,
                      output_register_count, subject_index);
@@ -210,10 +218,344 @@ int32_t ExperimentalRegExp::MatchForCallFromJs(
   Tagged<IrRegExpData> regexp_data_obj =
       Cast<IrRegExpData>(Tagged<Object>(regexp_data));
 
+  if (regexp_data_obj->MarkedForTierUp()) {
+    // We only get here through the trampoline, i.e. there is no native code
+    // for this subject representation yet. Returning RETRY re-enters through
+    // the runtime, where the tier-up compilation takes place.
+    return RegExp::kInternalRegExpRetry;
+  }
+
   return ExecRaw(isolate, RegExp::kFromJs, regexp_data_obj, subject_string,
                  output_registers, output_register_count, start_position);
 }
 
+namespace {
+
+// Upper bound on the number of matches found by a single interpreter run.
+constexpr int kMatchesPerBatch = 64;
+
+// The subject is split into more chunks than there are threads, so that
+// threads which are done early can help with the remaining chunks.
+constexpr int kChunksPerThread = 4;
+
+// Returns the index at which the search continues after `match`.
+int NextSearchIndex(const int32_t* match) {
+  // Zero-length matches advance by one code unit, like the interpreter does.
+  static_assert(!ExperimentalRegExp::kSupportsUnicode);
+  return match[0] == match[1] ? match[1] + 1 : match[1];
+}
+
+// Appends the registers of up to kMatchesPerBatch matches that start in
+// [start_index, match_start_limit) to `registers`.  Returns the number of
+// matches, or a negative value if the interpreter failed.
+template <class Character>
+int AppendMatches(base::Vector<const RegExpInstruction> bytecode,
+                  int register_count_per_match,
+                  base::Vector<const Character> subject, int start_index,
+                  int match_start_limit, std::vector<int32_t>* registers,
+                  Zone* zone) {
+  const size_t old_size = registers->size();
+  const int output_register_count = kMatchesPerBatch * register_count_per_match;
+  registers->resize(old_size + output_register_count);
+  int result = ExperimentalRegExpInterpreter::FindMatches(
+      bytecode, register_count_per_match, subject, start_index,
+      match_start_limit, registers->data() + old_size, output_register_count,
+      zone);
+  registers->resize(old_size + std::max(result, 0) * register_count_per_match);
+  zone->Reset();
+  return result;
+}
+
+// The matches found by a search that starts at the beginning of the chunk
+// [start, end) of the subject.  All matches start inside the chunk, but they
+// may end after it.
+struct ChunkMatches {
+  int start;
+  int end;
+  std::vector<int32_t> registers;
+  // Negative if the interpreter failed.
+  int result = RegExp::kInternalRegExpSuccess;
+};
+
+template <class Character>
+class ParallelSearchJob final : public JobTask {
+ public:
+  ParallelSearchJob(AccountingAllocator* allocator,
+                    base::Vector<const RegExpInstruction> bytecode,
+                    int register_count_per_match,
+                    base::Vector<const Character> subject,
+                    std::vector<ChunkMatches>* chunks)
+      : allocator_(allocator),
+        bytecode_(bytecode),
+        register_count_per_match_(register_count_per_match),
+        subject_(subject),
+        chunks_(chunks),
+        remaining_chunks_(chunks->size()) {}
+
+  void Run(JobDelegate* delegate) override {
+    Zone zone(allocator_, ZONE_NAME);
+    while (SearchNextChunk(&zone) && !delegate->ShouldYield()) {
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+    if (cancelled_.load(std::memory_order_relaxed)) return 0;
+    size_t next_chunk = next_chunk_.load(std::memory_order_relaxed);
+    return chunks_->size() - std::min(next_chunk, chunks_->size());
+  }
+
+  // Searches the next chunk that nobody has started on yet.  Returns false if
+  // there is none.  Also called on the main thread.
+  bool SearchNextChunk(Zone* zone) {
+    if (cancelled_.load(std::memory_order_relaxed)) return false;
+    size_t index = next_chunk_.fetch_add(1, std::memory_order_relaxed);
+    if (index >= chunks_->size()) return false;
+    SearchChunk(&(*chunks_)[index], zone);
+    if (remaining_chunks_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      base::MutexGuard guard(&mutex_);
+      all_chunks_done_.NotifyAll();
+    }
+    return true;
+  }
+
+  bool AllChunksDone() const {
+    return remaining_chunks_.load(std::memory_order_acquire) == 0;
+  }
+
+  // Waits until all chunks are done or `timeout` expired, whichever comes
+  // first.
+  void WaitForAllChunks(base::TimeDelta timeout) {
+    base::MutexGuard guard(&mutex_);
+    if (AllChunksDone()) return;
+    USE(all_chunks_done_.WaitFor(&mutex_, timeout));
+  }
+
+  // Makes workers stop at the next batch of matches.  The results of the
+  // chunks are incomplete afterwards.
+  void Cancel() { cancelled_.store(true, std::memory_order_relaxed); }
+
+ private:
+  void SearchChunk(ChunkMatches* chunk, Zone* zone) {
+    int index = chunk->start;
+    while (!cancelled_.load(std::memory_order_relaxed)) {
+      int result =
+          AppendMatches(bytecode_, register_count_per_match_, subject_, index,
+                        chunk->end, &chunk->registers, zone);
+      if (result < 0) {
+        chunk->result = result;
+        return;
+      }
+      if (result < kMatchesPerBatch) return;
+      const int32_t* last_match = &chunk->registers.back() + 1 -
+                                  register_count_per_match_;
+      index = NextSearchIndex(last_match);
+      if (index > subject_.length()) return;
+    }
+  }
+
+  AccountingAllocator* const allocator_;
+  const base::Vector<const RegExpInstruction> bytecode_;
+  const int register_count_per_match_;
+  const base::Vector<const Character> subject_;
+  std::vector<ChunkMatches>* const chunks_;
+  std::atomic<size_t> next_chunk_{0};
+  std::atomic<size_t> remaining_chunks_;
+  std::atomic<bool> cancelled_{false};
+  base::Mutex mutex_;
+  base::ConditionVariable all_chunks_done_;
+};
+
+template <class Character>
+int32_t ExecAllInParallelImpl(Isolate* isolate,
+                              base::Vector<const RegExpInstruction> bytecode,
+                              int register_count_per_match,
+                              base::Vector<const Character> subject,
+                              std::vector<int32_t>* output_registers) {
+  const int length = subject.length();
+  const int chunk_count =
+      (V8::GetCurrentPlatform()->NumberOfWorkerThreads() + 1) *
+      kChunksPerThread;
+  const int chunk_length =
+      std::max(1, (length + chunk_count - 1) / chunk_count);
+
+  // Matches may also start at the end of the subject, e.g. empty ones, so the
+  // last chunk ends after it.
+  std::vector<ChunkMatches> chunks;
+  for (int start = 0; start <= length; start += chunk_length) {
+    chunks.push_back({start, std::min(start + chunk_length, length + 1)});
+  }
+
+  if (v8_flags.trace_experimental_regexp_engine) {
+    StdoutStream{} << "Searching subject of length " << length << " in "
+                   << chunks.size() << " chunks in parallel" << std::endl;
+  }
+
+  auto job = std::make_unique<ParallelSearchJob<Character>>(
+      isolate->allocator(), bytecode, register_count_per_match, subject,
+      &chunks);
+  ParallelSearchJob<Character>* search = job.get();
+  std::unique_ptr<JobHandle> job_handle = V8::GetCurrentPlatform()->PostJob(
+      TaskPriority::kUserBlocking, std::move(job));
+
+  // The main thread searches chunks as well, and checks for interrupts in
+  // between.  It can't handle them here, as the workers access the subject
+  // directly, so an interrupt (e.g. termination) cancels the search and the
+  // caller falls back to the sequential search, which handles it.
+  {
+    Zone zone(isolate->allocator(), ZONE_NAME);
+    StackLimitCheck check(isolate);
+    while (!search->AllChunksDone()) {
+      if (check.InterruptRequested()) {
+        search->Cancel();
+        job_handle->Cancel();
+        return RegExp::kInternalRegExpRetry;
+      }
+      if (!search->SearchNextChunk(&zone)) {
+        // The remaining chunks are being searched by workers.
+        static constexpr base::TimeDelta kInterruptCheckInterval =
+            base::TimeDelta::FromMilliseconds(1);
+        search->WaitForAllChunks(kInterruptCheckInterval);
+      }
+    }
+  }
+  job_handle->Join();
+
+  for (const ChunkMatches& chunk : chunks) {
+    if (chunk.result < 0) return chunk.result;
+  }
+
+  // Stitch the matches of the chunks together.  The search of a chunk started
+  // at the beginning of the chunk, whereas the sequential search continues
+  // after the last match, which may have ended anywhere in the chunk.  Since
+  // the match at a given start position doesn't depend on where the search
+  // started, both searches find the same match if the sequential search
+  // continues at an index between the match and the index at which the chunk's
+  // search continued before finding it.  Otherwise the sequential search
+  // continues inside of a match of the chunk's search, and we search
+  // sequentially until the two searches meet again.
+  Zone zone(isolate->allocator(), ZONE_NAME);
+  std::vector<int32_t> sequential_registers;
+  int match_count = 0;
+  int index = 0;
+  size_t chunk_index = 0;
+  int chunk_match_index = 0;
+  auto add_match = [&](const int32_t* match) {
+    output_registers->insert(output_registers->end(), match,
+                             match + register_count_per_match);
+    ++match_count;
+    index = NextSearchIndex(match);
+  };
+  while (index <= length) {
+    while (chunks[chunk_index].end <= index) {
+      // The matches of the chunk are in `output_registers` now.
+      std::vector<int32_t>().swap(chunks[chunk_index].registers);
+      ++chunk_index;
+      chunk_match_index = 0;
+    }
+    const ChunkMatches& chunk = chunks[chunk_index];
+    const int chunk_match_count =
+        static_cast<int>(chunk.registers.size()) / register_count_per_match;
+    auto chunk_match = [&](int i) {
+      return &chunk.registers[i * register_count_per_match];
+    };
+    while (chunk_match_index < chunk_match_count &&
+           chunk_match(chunk_match_index)[0] < index) {
+      ++chunk_match_index;
+    }
+    const int chunk_search_index =
+        chunk_match_index == 0
+            ? chunk.start
+            : NextSearchIndex(chunk_match(chunk_match_index - 1));
+    if (chunk_search_index <= index) {
+      if (chunk_match_index < chunk_match_count) {
+        add_match(chunk_match(chunk_match_index++));
+      } else {
+        index = chunk.end;
+      }
+    } else {
+      sequential_registers.clear();
+      int result =
+          AppendMatches(bytecode, register_count_per_match, subject, index,
+                        chunk.end, &sequential_registers, &zone);
+      if (result < 0) return result;
+      for (int i = 0; i < result; ++i) {
+        add_match(&sequential_registers[i * register_count_per_match]);
+      }
+      if (result < kMatchesPerBatch) index = std::max(index, chunk.end);
+    }
+  }
+
+  return match_count;
+}
+
+}  // namespace
+
+bool ExperimentalRegExp::CanExecInParallel(Tagged<IrRegExpData> regexp_data,
+                                           Tagged<String> subject) {
+  // Sticky regexps have to match exactly where the previous match ended, so
+  // their search can't start at arbitrary positions.  Global regexps have no
+  // lookbehinds (see ExperimentalRegExpCompiler::CanBeHandled), which would
+  // have to be evaluated from the start of the subject.
+  return v8_flags.experimental_regexp_engine_parallel_global_match &&
+         IsGlobal(JSRegExp::AsRegExpFlags(regexp_data->flags())) &&
+         !IsSticky(JSRegExp::AsRegExpFlags(regexp_data->flags())) &&
+         subject->length() >=
+             v8_flags.experimental_regexp_engine_parallel_global_match_min_length;
+}
+
+int32_t ExperimentalRegExp::ExecAllInParallel(
+    Isolate* isolate, DirectHandle<IrRegExpData> regexp_data,
+    DirectHandle<String> subject, std::vector<int32_t>* output_registers) {
+  DCHECK(CanExecInParallel(*regexp_data, *subject));
+  DCHECK(IsCompiled(regexp_data, isolate));
+  DCHECK(subject->IsFlat());
+  // The workers access the bytecode and the subject directly.  The main
+  // thread only waits for them, so nothing can move these objects meanwhile.
+  DisallowGarbageCollection no_gc;
+
+  static constexpr bool kIsLatin1 = true;
+  base::Vector<const RegExpInstruction> bytecode =
+      AsInstructionSequence(regexp_data->bytecode(kIsLatin1));
+  int register_count_per_match =
+      JSRegExp::RegistersForCaptureCount(regexp_data->capture_count());
+
+  String::FlatContent content = subject->GetFlatContent(no_gc);
+  if (content.IsOneByte()) {
+    return ExecAllInParallelImpl(isolate, bytecode, register_count_per_match,
+                                 content.ToOneByteVector(), output_registers);
+  } else {
+    return ExecAllInParallelImpl(isolate, bytecode, register_count_per_match,
+                                 content.ToUC16Vector(), output_registers);
+  }
+}
+
+namespace {
+
+bool HasNativeCode(Isolate* isolate, DirectHandle<IrRegExpData> regexp_data,
+                   bool is_one_byte) {
+  return regexp_data->code(isolate, is_one_byte)->builtin_id() !=
+         Builtin::kRegExpExperimentalTrampoline;
+}
+
+// Replaces the trampoline to the interpreter by native irregexp code. The
+// native code gives up on excessive backtracking and falls back to this
+// engine, so the linear-time guarantee is kept up to a constant amount of
+// backtracking work per execution.
+void TierUp(Isolate* isolate, DirectHandle<IrRegExpData> regexp_data,
+            Handle<String> subject, bool is_one_byte) {
+  if (v8_flags.trace_experimental_regexp_engine) {
+    StdoutStream{} << "Tiering up experimental regexp "
+                   << regexp_data->source() << std::endl;
+  }
+  if (!RegExp::CompileExperimentalToNative(isolate, regexp_data, subject,
+                                           is_one_byte)) {
+    // Don't try again; the interpreter keeps working on its own.
+    regexp_data->set_ticks_until_tier_up(JSRegExp::kUninitializedValue);
+  }
+}
+
+}  // namespace
+
 MaybeHandle<Object> ExperimentalRegExp::Exec(
     Isolate* isolate, DirectHandle<IrRegExpData> regexp_data,
     Handle<String> subject, int subject_index,
@@ -233,6 +575,13 @@ MaybeHandle<Object> ExperimentalRegExp::Exec(
 
   subject = String::Flatten(isolate, subject);
 
+  if (regexp_data->MarkedForTierUp()) {
+    bool is_one_byte = String::IsOneByteRepresentationUnderneath(*subject);
+    if (!HasNativeCode(isolate, regexp_data, is_one_byte)) {
+      TierUp(isolate, regexp_data, subject, is_one_byte);
+    }
+  }
+
   int capture_count = regexp_data->capture_count();
   int output_register_count = JSRegExp::RegistersForCaptureCount(capture_count);
 
@@ -278,13 +627,34 @@ int32_t ExperimentalRegExp::OneshotExecRaw(
     Isolate* isolate, DirectHandle<IrRegExpData> regexp_data,
     DirectHandle<String> subject, int32_t* output_registers,
     int32_t output_register_count, int32_t subject_index) {
-  CHECK(v8_flags.enable_experimental_regexp_engine_on_excessive_backtracks);
-
   if (v8_flags.trace_experimental_regexp_engine) {
     StdoutStream{} << "Experimental execution (oneshot) of regexp "
                    << regexp_data->source() << std::endl;
   }
 
+  // We only get here once native code ran out of its backtrack budget: the
+  // flag or Isolate-wide budget for irregexps, or the budget of a tiered-up
+  // experimental regexp.
+  isolate->ReportRegExpBacktrackBudgetExceeded(
+      direct_handle(regexp_data->source(), isolate),
+      static_cast<int>(regexp_data->flags()));
+
+  if (regexp_data->type_tag() == RegExpData::Type::EXPERIMENTAL) {
+    // Fallback from native code of a tiered-up experimental regexp. The
+    // experimental bytecode is still around, so there's nothing to compile.
+    DCHECK(IsCompiled(regexp_data, isolate));
+    DisallowGarbageCollection no_gc;
+    // A pattern that exhausted the backtrack budget once is likely to do so
+    // again, and then every execution pays for the wasted backtracking on top
+    // of the interpreter. Go back to the trampoline for good.
+    static constexpr bool kIsLatin1 = true;
+    regexp_data->SetBytecodeForExperimental(isolate,
+                                            regexp_data->bytecode(kIsLatin1));
+    regexp_data->set_ticks_until_tier_up(JSRegExp::kUninitializedValue);
+    return ExecRaw(isolate, RegExp::kFromRuntime, *regexp_data, *subject,
+                   output_registers, output_register_count, subject_index);
+  }
+
   std::optional<CompilationResult> compilation_result =
       CompileImpl(isolate, regexp_data);
   if (!compilation_result.has_value()) return RegExp::kInternalRegExpException;
@@ -300,8 +670,6 @@ MaybeHandle<Object> ExperimentalRegExp::OneshotExec(
     Isolate* isolate, DirectHandle<IrRegExpData> regexp_data,
     DirectHandle<String> subject, int subject_index,
     Handle<RegExpMatchInfo> last_match_info, RegExp::ExecQuirks exec_quirks) {
-  DCHECK(v8_flags.enable_experimental_regexp_engine_on_excessive_backtracks);
-
   int capture_count = regexp_data->capture_count();
   int output_register_count = JSRegExp::RegistersForCaptureCount(capture_count);
 
@@ -5,6 +5,8 @@
 #ifndef V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_H_
 #define V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_H_
 
+#include <vector>
+
 #include "src/regexp/regexp-flags.h"
 #include "src/regexp/regexp.h"
 
@@ -46,8 +48,24 @@ class ExperimentalRegExp final : public AllStatic {
                          Tagged<String> subject, int32_t* output_registers,
                          int32_t output_register_count, int32_t subject_index);
 
+  // Global regexps can search large subjects in parallel: The subject is split
+  // into chunks that are searched on worker threads, and the results are
+  // stitched together on the main thread.  ExecAllInParallel appends the
+  // registers of all matches to `output_registers` and returns the number of
+  // matches, or a negative value if the interpreter failed or an interrupt
+  // cancelled the search, in which case the caller should search sequentially
+  // instead.
+  static bool CanExecInParallel(Tagged<IrRegExpData> regexp_data,
+                                Tagged<String> subject);
+  static int32_t ExecAllInParallel(Isolate* isolate,
+                                   DirectHandle<IrRegExpData> regexp_data,
+                                   DirectHandle<String> subject,
+                                   std::vector<int32_t>* output_registers);
+
   // Compile and execute a regexp with the experimental engine, regardless of
   // its type tag.  The regexp itself is not changed (apart from lastIndex).
+  // EXPERIMENTAL regexps end up here when their native code (see tier-up in
+  // Exec) falls back; they reuse their existing bytecode.
   static MaybeHandle<Object> OneshotExec(
       Isolate* isolate, DirectHandle<IrRegExpData> regexp_data,
       DirectHandle<String> subject, int index,
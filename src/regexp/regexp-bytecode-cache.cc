@@ -0,0 +1,223 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/regexp-bytecode-cache.h"
+
+#include <deque>
+#include <unordered_map>
+
+#include "src/base/functional.h"
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
+#include "src/flags/flags.h"
+#include "src/objects/js-regexp.h"
+#include "src/objects/string-inl.h"
+
+namespace v8 {
+namespace internal {
+
+bool RegExpBytecodeCache::Key::operator==(const Key& other) const {
+  return pattern == other.pattern && flags == other.flags &&
+         is_one_byte == other.is_one_byte &&
+         backtrack_limit == other.backtrack_limit &&
+         backtrack_budget == other.backtrack_budget &&
+         flag_hash == other.flag_hash;
+}
+
+namespace {
+
+using Key = RegExpBytecodeCache::Key;
+using Entry = RegExpBytecodeCache::Entry;
+
+struct KeyHash {
+  size_t operator()(const Key& key) const {
+    return base::hash_combine(
+        base::hash_range(key.pattern.begin(), key.pattern.end()), key.flags,
+        key.is_one_byte, key.backtrack_limit, key.backtrack_budget,
+        key.flag_hash);
+  }
+};
+
+// Entries are evicted in insertion order once the size of the cache exceeds
+// --regexp-shared-bytecode-cache-max-size.
+class RegExpBytecodeCacheImpl {
+ public:
+  std::optional<Entry> Lookup(const Key& key) {
+    base::MutexGuard guard(&mutex_);
+    auto it = map_.find(key);
+    if (it == map_.end()) return {};
+    return it->second;
+  }
+
+  void Insert(Key key, Entry entry) {
+    const size_t entry_size = EntrySize(key, entry);
+    const size_t max_size =
+        static_cast<size_t>(v8_flags.regexp_shared_bytecode_cache_max_size) *
+        KB;
+    if (entry_size > max_size) return;
+    base::MutexGuard guard(&mutex_);
+    while (size_ + entry_size > max_size) {
+      auto it = map_.find(*insertion_order_.front());
+      size_ -= EntrySize(it->first, it->second);
+      insertion_order_.pop_front();
+      map_.erase(it);
+    }
+    auto [it, inserted] = map_.emplace(std::move(key), std::move(entry));
+    // Another isolate may have compiled the same pattern concurrently.
+    if (!inserted) return;
+    insertion_order_.push_back(&it->first);
+    size_ += entry_size;
+  }
+
+  void Clear() {
+    base::MutexGuard guard(&mutex_);
+    insertion_order_.clear();
+    map_.clear();
+    size_ = 0;
+  }
+
+ private:
+  static size_t EntrySize(const Key& key, const Entry& entry) {
+    return key.pattern.size() * sizeof(base::uc16) + entry.bytecode.size();
+  }
+
+  base::Mutex mutex_;
+  // Pointers to keys stay valid until their element is erased.
+  std::unordered_map<Key, Entry, KeyHash> map_;
+  std::deque<const Key*> insertion_order_;
+  size_t size_ = 0;
+};
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(RegExpBytecodeCacheImpl,
+                                GetRegExpBytecodeCacheImpl)
+
+Key DefaultKey(std::vector<base::uc16> pattern, int flags, bool is_one_byte) {
+  return {std::move(pattern), flags, is_one_byte,
+          JSRegExp::kNoBacktrackLimit, 0, FlagList::Hash()};
+}
+
+// The serialized section consists of the number of entries, followed by the
+// entries:
+//   uint32_t flags
+//   uint32_t is_one_byte
+//   uint32_t register_count
+//   uint32_t backtrack_limit
+//   uint32_t pattern length, followed by the uc16 characters of the pattern
+//   uint32_t bytecode length, followed by the bytecode
+void WriteUInt32(uint32_t value, std::vector<uint8_t>* sink) {
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+  sink->insert(sink->end(), bytes, bytes + sizeof(value));
+}
+
+void WriteBytes(const void* data, size_t size, std::vector<uint8_t>* sink) {
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+  sink->insert(sink->end(), bytes, bytes + size);
+}
+
+class SectionReader {
+ public:
+  explicit SectionReader(base::Vector<const uint8_t> data) : data_(data) {}
+
+  bool ReadUInt32(uint32_t* value) {
+    return ReadBytes(value, sizeof(*value));
+  }
+
+  bool ReadBytes(void* target, size_t size) {
+    if (size > data_.size() - position_) return false;
+    memcpy(target, data_.begin() + position_, size);
+    position_ += size;
+    return true;
+  }
+
+ private:
+  base::Vector<const uint8_t> data_;
+  size_t position_ = 0;
+};
+
+}  // namespace
+
+// static
+std::vector<base::uc16> RegExpBytecodeCache::Pattern(Tagged<String> source) {
+  std::vector<base::uc16> pattern(source->length());
+  String::WriteToFlat(source, pattern.data(), 0, source->length());
+  return pattern;
+}
+
+// static
+std::optional<Entry> RegExpBytecodeCache::Lookup(const Key& key) {
+  return GetRegExpBytecodeCacheImpl()->Lookup(key);
+}
+
+// static
+void RegExpBytecodeCache::Insert(Key key, Entry entry) {
+  GetRegExpBytecodeCacheImpl()->Insert(std::move(key), std::move(entry));
+}
+
+// static
+void RegExpBytecodeCache::Clear() { GetRegExpBytecodeCacheImpl()->Clear(); }
+
+// static
+void RegExpBytecodeCache::Serialize(
+    const std::vector<std::pair<Tagged<String>, int>>& literals,
+    std::vector<uint8_t>* sink) {
+  std::vector<std::pair<Key, Entry>> entries;
+  for (const auto& [source, flags] : literals) {
+    for (bool is_one_byte : {true, false}) {
+      Key key = DefaultKey(Pattern(source), flags, is_one_byte);
+      std::optional<Entry> entry = Lookup(key);
+      if (entry.has_value()) {
+        entries.emplace_back(std::move(key), std::move(entry.value()));
+      }
+    }
+  }
+  WriteUInt32(static_cast<uint32_t>(entries.size()), sink);
+  for (const auto& [key, entry] : entries) {
+    WriteUInt32(static_cast<uint32_t>(key.flags), sink);
+    WriteUInt32(key.is_one_byte, sink);
+    WriteUInt32(static_cast<uint32_t>(entry.register_count), sink);
+    WriteUInt32(entry.backtrack_limit, sink);
+    WriteUInt32(static_cast<uint32_t>(key.pattern.size()), sink);
+    WriteBytes(key.pattern.data(), key.pattern.size() * sizeof(base::uc16),
+               sink);
+    WriteUInt32(static_cast<uint32_t>(entry.bytecode.size()), sink);
+    WriteBytes(entry.bytecode.data(), entry.bytecode.size(), sink);
+  }
+}
+
+// static
+bool RegExpBytecodeCache::Deserialize(base::Vector<const uint8_t> data) {
+  SectionReader reader(data);
+  uint32_t count;
+  if (!reader.ReadUInt32(&count)) return false;
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t flags, is_one_byte, register_count, backtrack_limit;
+    uint32_t pattern_length, bytecode_length;
+    if (!reader.ReadUInt32(&flags) || !reader.ReadUInt32(&is_one_byte) ||
+        !reader.ReadUInt32(&register_count) ||
+        !reader.ReadUInt32(&backtrack_limit) ||
+        !reader.ReadUInt32(&pattern_length) ||
+        pattern_length > data.size()) {
+      return false;
+    }
+    std::vector<base::uc16> pattern(pattern_length);
+    if (!reader.ReadBytes(pattern.data(),
+                          pattern_length * sizeof(base::uc16)) ||
+        !reader.ReadUInt32(&bytecode_length) ||
+        bytecode_length > data.size()) {
+      return false;
+    }
+    Entry entry{std::vector<uint8_t>(bytecode_length),
+                static_cast<int>(register_count), backtrack_limit};
+    if (!reader.ReadBytes(entry.bytecode.data(), bytecode_length)) {
+      return false;
+    }
+    Insert(DefaultKey(std::move(pattern), static_cast<int>(flags),
+                      is_one_byte != 0),
+           std::move(entry));
+  }
+  return true;
+}
+
+}  // namespace internal
+}  // namespace v8
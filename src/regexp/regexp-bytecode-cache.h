@@ -0,0 +1,71 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
+#define V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
+
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "src/base/strings.h"
+#include "src/base/vector.h"
+#include "src/common/globals.h"
+#include "src/objects/tagged.h"
+
+namespace v8 {
+namespace internal {
+
+class String;
+
+// A process-wide cache of Irregexp bytecode. Unlike native code, bytecode
+// refers neither to the heap nor to the isolate it was generated in, so all
+// isolates that compile the same pattern can share it. Entries for regexp
+// literals can also be stored in the code cache (see CodeSerializer), so that
+// a warm start skips compiling them.
+class RegExpBytecodeCache final : public AllStatic {
+ public:
+  struct Key {
+    std::vector<base::uc16> pattern;
+    int flags;
+    bool is_one_byte;
+    // The backtrack limit of the regexp and the backtrack budget of the
+    // isolate decide whether the bytecode falls back to the experimental
+    // engine on excessive backtracking (see RegExpImpl::Compile).
+    uint32_t backtrack_limit;
+    uint32_t backtrack_budget;
+    // Flags such as --regexp-peephole-optimization change the bytecode.
+    uint32_t flag_hash;
+
+    bool operator==(const Key& other) const;
+  };
+
+  struct Entry {
+    std::vector<uint8_t> bytecode;
+    int register_count;
+    // The backtrack limit of the regexp after compilation.
+    uint32_t backtrack_limit;
+  };
+
+  static std::vector<base::uc16> Pattern(Tagged<String> source);
+
+  static std::optional<Entry> Lookup(const Key& key);
+  static void Insert(Key key, Entry entry);
+  static void Clear();
+
+  // Writes the cached bytecode of the given regexp literals, i.e. the entries
+  // for their pattern and flags that were compiled with the default limits, to
+  // `sink`.
+  static void Serialize(
+      const std::vector<std::pair<Tagged<String>, int>>& literals,
+      std::vector<uint8_t>* sink);
+  // Inserts the entries written by Serialize into the cache. Returns false if
+  // `data` is malformed.
+  static bool Deserialize(base::Vector<const uint8_t> data);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_REGEXP_BYTECODE_CACHE_H_
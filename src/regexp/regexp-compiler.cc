@@ -3036,7 +3036,13 @@ void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
   }
 
   if (found_single_character) {
-    // TODO(pthier): Add vectorized version.
+    const uint32_t mask =
+        max_char_ > kSize ? RegExpMacroAssembler::kTableMask : 0xffff;
+    if (masm->SkipUntilCharAndUseSimd(lookahead_width)) {
+      masm->SkipUntilCharAnd(max_lookahead, single_character, mask,
+                             lookahead_width);
+      return;
+    }
     Label cont, again;
     masm->Bind(&again);
     masm->LoadCurrentCharacter(max_lookahead, &cont, true);
@@ -3252,7 +3258,8 @@ Trace* ChoiceNode::EmitGreedyLoop(RegExpCompiler* compiler, Trace* trace,
   // information for each iteration of the loop, which could take up a lot of
   // space.
   DCHECK(trace->stop_node() == nullptr);
-  macro_assembler->PushCurrentPosition();
+  const bool possessive = GreedyLoopIsPossessive(compiler, text_length);
+  if (!possessive) macro_assembler->PushCurrentPosition();
   Label greedy_match_failed;
   Trace greedy_match_trace;
   if (not_at_start()) greedy_match_trace.set_at_start(Trace::FALSE_VALUE);
@@ -3269,6 +3276,14 @@ Trace* ChoiceNode::EmitGreedyLoop(RegExpCompiler* compiler, Trace* trace,
 
   Trace* new_trace = greedy_loop_state->counter_backtrack_trace();
 
+  if (possessive) {
+    // Stepping back into the loop can't make the continuation match, so it is
+    // only tried once, at the end of the greedy match.
+    new_trace->set_backtrack(trace->backtrack());
+    EmitChoices(compiler, alt_gens, 1, new_trace, preload);
+    return new_trace;
+  }
+
   EmitChoices(compiler, alt_gens, 1, new_trace, preload);
 
   macro_assembler->Bind(greedy_loop_state->label());
@@ -3280,6 +3295,40 @@ Trace* ChoiceNode::EmitGreedyLoop(RegExpCompiler* compiler, Trace* trace,
   return new_trace;
 }
 
+// A greedy loop is possessive if backtracking into it can never succeed,
+// e.g. /[a-z]+[0-9]/. This is the case if the loop consumes one character per
+// iteration and the continuation has to start with a character the loop body
+// doesn't match: any earlier position the greedy loop could step back to holds
+// a character that was matched by the body. For these loops, neither the
+// start position nor the positions to step back to have to be kept around.
+bool ChoiceNode::GreedyLoopIsPossessive(RegExpCompiler* compiler,
+                                        int text_length) {
+  if (!compiler->optimize() || text_length != 1 ||
+      alternatives_->length() != 2) {
+    return false;
+  }
+  GuardedAlternative continuation = alternatives_->at(1);
+  ZoneList<Guard*>* guards = continuation.guards();
+  if (guards != nullptr && guards->length() != 0) return false;
+  // The Boyer-Moore info is only valid for as many characters as the node
+  // eats at least.
+  if (continuation.node()->EatsAtLeast(not_at_start()) < 1) return false;
+
+  Isolate* isolate = compiler->macro_assembler()->isolate();
+  BoyerMooreLookahead* body_bm =
+      zone()->New<BoyerMooreLookahead>(1, compiler, zone());
+  alternatives_->at(0).node()->FillInBMInfo(isolate, 0, kRecursionBudget,
+                                            body_bm, not_at_start());
+  BoyerMooreLookahead* continuation_bm =
+      zone()->New<BoyerMooreLookahead>(1, compiler, zone());
+  continuation.node()->FillInBMInfo(isolate, 0, kRecursionBudget,
+                                    continuation_bm, not_at_start());
+  // The maps are indexed by code unit mod the map size, so disjoint maps imply
+  // disjoint character sets.
+  return (body_bm->at(0)->raw_bitset() & continuation_bm->at(0)->raw_bitset())
+      .none();
+}
+
 int ChoiceNode::EmitOptimizedUnanchoredSearch(RegExpCompiler* compiler,
                                               Trace* trace) {
   int eats_at_least = PreloadState::kEatsAtLeastNotYetInitialized;
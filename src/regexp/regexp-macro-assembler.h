@@ -113,6 +113,17 @@ class RegExpMacroAssembler {
                                    int advance_by) = 0;
   virtual bool SkipUntilBitInTableUseSimd(int advance_by) { return false; }
 
+  // Advances the current position by {advance_by} until the character at
+  // {cp_offset} (after and-ing it with {mask}) equals {c}, or the end of the
+  // subject is reached. The vectorized implementation may stop at an earlier
+  // position at which the character matches. Only called if
+  // SkipUntilCharAndUseSimd returns true.
+  virtual void SkipUntilCharAnd(int cp_offset, uint32_t c, uint32_t mask,
+                                int advance_by) {
+    UNREACHABLE();
+  }
+  virtual bool SkipUntilCharAndUseSimd(int advance_by) { return false; }
+
   // Checks whether the given offset from the current position is before
   // the end of the string.  May overwrite the current character.
   virtual void CheckPosition(int cp_offset, Label* on_outside_input);
@@ -683,6 +683,7 @@ class ChoiceNode : public RegExpNode {
                         AlternativeGenerationList* alt_gens,
                         PreloadState* preloads,
                         GreedyLoopState* greedy_loop_state, int text_length);
+  bool GreedyLoopIsPossessive(RegExpCompiler* compiler, int text_length);
   void EmitChoices(RegExpCompiler* compiler,
                    AlternativeGenerationList* alt_gens, int first_choice,
                    Trace* trace, PreloadState* preloads);
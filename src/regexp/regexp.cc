@@ -4,13 +4,16 @@
 
 #include "src/regexp/regexp.h"
 
+#include "src/base/bits.h"
 #include "src/base/strings.h"
 #include "src/codegen/compilation-cache.h"
 #include "src/diagnostics/code-tracer.h"
 #include "src/execution/interrupts-scope.h"
 #include "src/heap/heap-inl.h"
+#include "src/logging/counters.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/regexp/experimental/experimental.h"
+#include "src/regexp/regexp-bytecode-cache.h"
 #include "src/regexp/regexp-bytecode-generator.h"
 #include "src/regexp/regexp-bytecodes.h"
 #include "src/regexp/regexp-compiler.h"
@@ -568,13 +571,52 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate,
                                         ? RegExpCompilationTarget::kBytecode
                                         : RegExpCompilationTarget::kNative;
   uint32_t backtrack_limit = re_data->backtrack_limit();
-  const bool compilation_succeeded =
-      Compile(isolate, &zone, &compile_data, flags, pattern, sample_subject,
-              is_one_byte, backtrack_limit);
-  if (!compilation_succeeded) {
-    DCHECK(compile_data.error != RegExpError::kNone);
-    RegExp::ThrowRegExpException(isolate, re_data, compile_data.error);
-    return false;
+  // Bytecode doesn't depend on the isolate, so isolates share it through a
+  // process-wide cache.
+  std::optional<RegExpBytecodeCache::Key> cache_key;
+  if (compile_data.compilation_target == RegExpCompilationTarget::kBytecode &&
+      v8_flags.regexp_shared_bytecode_cache &&
+      !v8_flags.print_regexp_bytecode) {
+    cache_key = RegExpBytecodeCache::Key{
+        RegExpBytecodeCache::Pattern(*pattern),
+        static_cast<int>(re_data->flags()),
+        is_one_byte,
+        backtrack_limit,
+        isolate->regexp_backtrack_budget(),
+        FlagList::Hash()};
+  }
+  std::optional<RegExpBytecodeCache::Entry> cached_entry;
+  if (cache_key.has_value()) {
+    cached_entry = RegExpBytecodeCache::Lookup(cache_key.value());
+  }
+  if (cached_entry.has_value()) {
+    isolate->counters()->regexp_bytecode_cache_hits()->Increment();
+    const int length = static_cast<int>(cached_entry->bytecode.size());
+    Handle<TrustedByteArray> bytecode =
+        isolate->factory()->NewTrustedByteArray(length);
+    MemCopy(bytecode->begin(), cached_entry->bytecode.data(), length);
+    compile_data.code = bytecode;
+    compile_data.register_count = cached_entry->register_count;
+    backtrack_limit = cached_entry->backtrack_limit;
+  } else {
+    const bool compilation_succeeded =
+        Compile(isolate, &zone, &compile_data, flags, pattern, sample_subject,
+                is_one_byte, backtrack_limit);
+    if (!compilation_succeeded) {
+      DCHECK(compile_data.error != RegExpError::kNone);
+      RegExp::ThrowRegExpException(isolate, re_data, compile_data.error);
+      return false;
+    }
+    if (cache_key.has_value()) {
+      isolate->counters()->regexp_bytecode_cache_misses()->Increment();
+      Tagged<TrustedByteArray> bytecode =
+          Cast<TrustedByteArray>(*compile_data.code);
+      RegExpBytecodeCache::Insert(
+          std::move(cache_key.value()),
+          {std::vector<uint8_t>(bytecode->begin(),
+                                bytecode->begin() + bytecode->length()),
+           compile_data.register_count, backtrack_limit});
+    }
   }
 
   if (compile_data.compilation_target == RegExpCompilationTarget::kNative) {
@@ -615,6 +657,49 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate,
   return true;
 }
 
+// static
+bool RegExp::CompileExperimentalToNative(Isolate* isolate,
+                                         DirectHandle<IrRegExpData> re_data,
+                                         Handle<String> sample_subject,
+                                         bool is_one_byte) {
+  DCHECK_EQ(re_data->type_tag(), RegExpData::Type::EXPERIMENTAL);
+  DCHECK(!v8_flags.jitless);
+  Zone zone(isolate->allocator(), ZONE_NAME);
+  PostponeInterruptsScope postpone(isolate);
+
+  RegExpFlags flags = JSRegExp::AsRegExpFlags(re_data->flags());
+
+  Handle<String> pattern(re_data->source(), isolate);
+  pattern = String::Flatten(isolate, pattern);
+  RegExpCompileData compile_data;
+  if (!RegExpParser::ParseRegExpFromHeapString(isolate, &zone, pattern, flags,
+                                               &compile_data)) {
+    // The pattern was parsed successfully before, so this can only be a stack
+    // overflow. Keep using the experimental interpreter.
+    DCHECK_EQ(compile_data.error, RegExpError::kStackOverflow);
+    return false;
+  }
+  compile_data.compilation_target = RegExpCompilationTarget::kNative;
+  compile_data.fallback_to_experimental = true;
+  uint32_t backtrack_limit = JSRegExp::kNoBacktrackLimit;
+  if (!RegExpImpl::Compile(isolate, &zone, &compile_data, flags, pattern,
+                           sample_subject, is_one_byte, backtrack_limit)) {
+    DCHECK(compile_data.error != RegExpError::kNone);
+    return false;
+  }
+  // The experimental bytecode stays in place: it is used by the runtime
+  // paths, for the other subject representation, and on fallback.
+  re_data->set_code(is_one_byte, Cast<Code>(*compile_data.code));
+
+  if (v8_flags.trace_regexp_tier_up) {
+    PrintF("Experimental JSRegExp data object %p tiered up, size: %d\n",
+           reinterpret_cast<void*>(re_data->ptr()),
+           re_data->code(isolate, is_one_byte)->Size());
+  }
+
+  return true;
+}
+
 void RegExpImpl::IrregexpInitialize(Isolate* isolate, DirectHandle<JSRegExp> re,
                                     DirectHandle<String> pattern,
                                     RegExpFlags flags, int capture_count,
@@ -945,14 +1030,21 @@ bool RegExpImpl::Compile(Isolate* isolate, Zone* zone, RegExpCompileData* data,
   }
 
   macro_assembler->set_slow_safe(TooMuchRegExpCode(isolate, pattern));
-  if (v8_flags.enable_experimental_regexp_engine_on_excessive_backtracks &&
-      ExperimentalRegExp::CanBeHandled(data->tree, pattern, flags,
-                                       data->capture_count)) {
+  // An Isolate-wide budget takes precedence over the flag. Either applies only
+  // if the experimental engine can take over once the budget is exhausted.
+  const uint32_t isolate_budget = isolate->regexp_backtrack_budget();
+  const uint32_t fallback_budget =
+      isolate_budget != 0 ? isolate_budget
+                          : v8_flags.regexp_backtracks_before_fallback.value();
+  if (data->fallback_to_experimental ||
+      ((isolate_budget != 0 ||
+        v8_flags.enable_experimental_regexp_engine_on_excessive_backtracks) &&
+       ExperimentalRegExp::CanBeHandled(data->tree, pattern, flags,
+                                        data->capture_count))) {
     if (backtrack_limit == JSRegExp::kNoBacktrackLimit) {
-      backtrack_limit = v8_flags.regexp_backtracks_before_fallback;
+      backtrack_limit = fallback_budget;
     } else {
-      backtrack_limit = std::min(
-          backtrack_limit, v8_flags.regexp_backtracks_before_fallback.value());
+      backtrack_limit = std::min(backtrack_limit, fallback_budget);
     }
     macro_assembler->set_backtrack_limit(backtrack_limit);
     macro_assembler->set_can_fallback(true);
@@ -1077,6 +1169,11 @@ RegExpGlobalCache::RegExpGlobalCache(Handle<RegExpData> regexp_data,
       }
       registers_per_match_ = JSRegExp::RegistersForCaptureCount(
           Cast<IrRegExpData>(regexp_data_)->capture_count());
+      if (ExperimentalRegExp::CanExecInParallel(
+              Cast<IrRegExpData>(*regexp_data_), *subject_) &&
+          FetchAllInParallel()) {
+        return;
+      }
       register_array_size_ = std::max(
           {registers_per_match_, Isolate::kJSRegexpStaticOffsetsVectorSize});
       break;
@@ -1105,12 +1202,36 @@ RegExpGlobalCache::RegExpGlobalCache(Handle<RegExpData> regexp_data,
 
 RegExpGlobalCache::~RegExpGlobalCache() {
   // Deallocate the register array if we allocated it in the constructor
-  // (as opposed to using the existing jsregexp_static_offsets_vector).
-  if (register_array_size_ > Isolate::kJSRegexpStaticOffsetsVectorSize) {
+  // (as opposed to using the existing jsregexp_static_offsets_vector or the
+  // matches found in parallel).
+  if (register_array_size_ > Isolate::kJSRegexpStaticOffsetsVectorSize &&
+      register_array_ != parallel_registers_.data()) {
     DeleteArray(register_array_);
   }
 }
 
+bool RegExpGlobalCache::FetchAllInParallel() {
+  int match_count = ExperimentalRegExp::ExecAllInParallel(
+      isolate_, Cast<IrRegExpData>(regexp_data_), subject_,
+      &parallel_registers_);
+  if (match_count < 0 || parallel_registers_.size() + registers_per_match_ >
+                             static_cast<size_t>(kMaxInt)) {
+    std::vector<int32_t>().swap(parallel_registers_);
+    return false;
+  }
+
+  // The matches are returned as a single batch with room for one more match,
+  // so that FetchNext fails after the last match like after a batch that was
+  // not fully filled.  The registers are used in place.
+  max_matches_ = match_count + 1;
+  register_array_size_ = max_matches_ * registers_per_match_;
+  parallel_registers_.resize(register_array_size_);
+  register_array_ = parallel_registers_.data();
+  num_matches_ = match_count;
+  current_match_index_ = -1;
+  return true;
+}
+
 int RegExpGlobalCache::AdvanceZeroLength(int last_index) {
   if (IsEitherUnicode(JSRegExp::AsRegExpFlags(regexp_data_->flags())) &&
       last_index + 1 < subject_->length() &&
@@ -1204,6 +1325,33 @@ int32_t* RegExpGlobalCache::LastSuccessfulMatch() {
   return &register_array_[index];
 }
 
+// static
+int RegExpResultsCache::SetStart(Tagged<FixedArray> cache,
+                                 Tagged<String> key_string) {
+  DCHECK(base::bits::IsPowerOfTwo(cache->length()));
+  uint32_t set_count = cache->length() / kSetLength;
+  return (key_string->hash() & (set_count - 1)) * kSetLength;
+}
+
+// static
+void RegExpResultsCache::MoveToFront(Tagged<FixedArray> cache, int set_start,
+                                     int way) {
+  DisallowGarbageCollection no_gc;
+  Tagged<Object> entry[kArrayEntriesPerCacheEntry];
+  int index = set_start + way * kArrayEntriesPerCacheEntry;
+  for (int i = 0; i < kArrayEntriesPerCacheEntry; i++) {
+    entry[i] = cache->get(index + i);
+  }
+  for (; index > set_start; index -= kArrayEntriesPerCacheEntry) {
+    for (int i = 0; i < kArrayEntriesPerCacheEntry; i++) {
+      cache->set(index + i, cache->get(index - kArrayEntriesPerCacheEntry + i));
+    }
+  }
+  for (int i = 0; i < kArrayEntriesPerCacheEntry; i++) {
+    cache->set(set_start + i, entry[i]);
+  }
+}
+
 Tagged<Object> RegExpResultsCache::Lookup(Heap* heap, Tagged<String> key_string,
                                           Tagged<Object> key_pattern,
                                           Tagged<FixedArray>* last_match_cache,
@@ -1221,21 +1369,21 @@ Tagged<Object> RegExpResultsCache::Lookup(Heap* heap, Tagged<String> key_string,
     cache = heap->regexp_multiple_cache();
   }
 
-  uint32_t hash = key_string->hash();
-  uint32_t index = ((hash & (kRegExpResultsCacheSize - 1)) &
-                    ~(kArrayEntriesPerCacheEntry - 1));
-  if (cache->get(index + kStringOffset) != key_string ||
-      cache->get(index + kPatternOffset) != key_pattern) {
-    index =
-        ((index + kArrayEntriesPerCacheEntry) & (kRegExpResultsCacheSize - 1));
-    if (cache->get(index + kStringOffset) != key_string ||
-        cache->get(index + kPatternOffset) != key_pattern) {
-      return Smi::zero();
+  Counters* counters = heap->isolate()->counters();
+  int set_start = SetStart(cache, key_string);
+  for (int way = 0; way < kWays; way++) {
+    int index = set_start + way * kArrayEntriesPerCacheEntry;
+    if (cache->get(index + kStringOffset) == key_string &&
+        cache->get(index + kPatternOffset) == key_pattern) {
+      if (way != 0) MoveToFront(cache, set_start, way);
+      counters->regexp_results_cache_hits()->Increment();
+      *last_match_cache =
+          Cast<FixedArray>(cache->get(set_start + kLastMatchOffset));
+      return cache->get(set_start + kArrayOffset);
     }
   }
-
-  *last_match_cache = Cast<FixedArray>(cache->get(index + kLastMatchOffset));
-  return cache->get(index + kArrayOffset);
+  counters->regexp_results_cache_misses()->Increment();
+  return Smi::zero();
 }
 
 void RegExpResultsCache::Enter(Isolate* isolate,
@@ -1258,33 +1406,39 @@ void RegExpResultsCache::Enter(Isolate* isolate,
     cache = factory->regexp_multiple_cache();
   }
 
-  uint32_t hash = key_string->hash();
-  uint32_t index = ((hash & (kRegExpResultsCacheSize - 1)) &
-                    ~(kArrayEntriesPerCacheEntry - 1));
-  if (cache->get(index + kStringOffset) == Smi::zero()) {
-    cache->set(index + kStringOffset, *key_string);
-    cache->set(index + kPatternOffset, *key_pattern);
-    cache->set(index + kArrayOffset, *value_array);
-    cache->set(index + kLastMatchOffset, *last_match_cache);
-  } else {
-    uint32_t index2 =
-        ((index + kArrayEntriesPerCacheEntry) & (kRegExpResultsCacheSize - 1));
-    if (cache->get(index2 + kStringOffset) == Smi::zero()) {
-      cache->set(index2 + kStringOffset, *key_string);
-      cache->set(index2 + kPatternOffset, *key_pattern);
-      cache->set(index2 + kArrayOffset, *value_array);
-      cache->set(index2 + kLastMatchOffset, *last_match_cache);
+  // The least recently used entry of the set is about to be evicted. Grow the
+  // cache instead if it isn't at its maximum size yet; the old entries are
+  // dropped.
+  int last_way_index = SetStart(*cache, *key_string) +
+                       (kWays - 1) * kArrayEntriesPerCacheEntry;
+  if (IsString(cache->get(last_way_index + kStringOffset))) {
+    if (cache->length() < kMaxRegExpResultsCacheSize &&
+        !v8_flags.optimize_for_size) {
+      cache = factory->NewFixedArray(kMaxRegExpResultsCacheSize,
+                                     AllocationType::kOld);
+      if (type == STRING_SPLIT_SUBSTRINGS) {
+        isolate->heap()->set_string_split_cache(*cache);
+      } else {
+        isolate->heap()->set_regexp_multiple_cache(*cache);
+      }
     } else {
-      cache->set(index2 + kStringOffset, Smi::zero());
-      cache->set(index2 + kPatternOffset, Smi::zero());
-      cache->set(index2 + kArrayOffset, Smi::zero());
-      cache->set(index2 + kLastMatchOffset, Smi::zero());
-      cache->set(index + kStringOffset, *key_string);
-      cache->set(index + kPatternOffset, *key_pattern);
-      cache->set(index + kArrayOffset, *value_array);
-      cache->set(index + kLastMatchOffset, *last_match_cache);
+      isolate->counters()->regexp_results_cache_evictions()->Increment();
     }
   }
+
+  {
+    DisallowGarbageCollection no_gc;
+    Tagged<FixedArray> raw_cache = *cache;
+    int set_start = SetStart(raw_cache, *key_string);
+    // Make the least recently used entry the most recently used one and
+    // overwrite it.
+    MoveToFront(raw_cache, set_start, kWays - 1);
+    raw_cache->set(set_start + kStringOffset, *key_string);
+    raw_cache->set(set_start + kPatternOffset, *key_pattern);
+    raw_cache->set(set_start + kArrayOffset, *value_array);
+    raw_cache->set(set_start + kLastMatchOffset, *last_match_cache);
+  }
+
   // If the array is a reasonably short list of substrings, convert it into a
   // list of internalized strings.
   if (type == STRING_SPLIT_SUBSTRINGS && value_array->length() < 100) {
@@ -1300,7 +1454,7 @@ void RegExpResultsCache::Enter(Isolate* isolate,
 }
 
 void RegExpResultsCache::Clear(Tagged<FixedArray> cache) {
-  for (int i = 0; i < kRegExpResultsCacheSize; i++) {
+  for (int i = 0; i < cache->length(); i++) {
     cache->set(i, Smi::zero());
   }
 }
@@ -5,6 +5,8 @@
 #ifndef V8_REGEXP_REGEXP_H_
 #define V8_REGEXP_REGEXP_H_
 
+#include <vector>
+
 #include "src/common/assert-scope.h"
 #include "src/handles/handles.h"
 #include "src/regexp/regexp-error.h"
@@ -66,6 +68,12 @@ struct RegExpCompileData {
 
   // The compilation target (bytecode or native code).
   RegExpCompilationTarget compilation_target;
+
+  // True, iff the generated code must fall back to the experimental engine
+  // on excessive backtracking regardless of
+  // --enable-experimental-regexp-engine-on-excessive-backtracks. Set when
+  // tiering up experimental regexps.
+  bool fallback_to_experimental = false;
 };
 
 class RegExp final : public AllStatic {
@@ -99,6 +107,17 @@ class RegExp final : public AllStatic {
       Isolate* isolate, DirectHandle<RegExpData> re_data,
       Handle<String> subject);
 
+  // Compiles an EXPERIMENTAL regexp to native irregexp code for subjects of
+  // the given representation and installs it in place of the trampoline to
+  // the experimental interpreter. The code falls back to the experimental
+  // engine after --regexp-backtracks-before-fallback backtracks, which keeps
+  // execution time bounded. Returns false if no code could be generated; no
+  // exception is thrown in that case.
+  static bool CompileExperimentalToNative(Isolate* isolate,
+                                          DirectHandle<IrRegExpData> re_data,
+                                          Handle<String> sample_subject,
+                                          bool is_one_byte);
+
   enum CallOrigin : int {
     kFromRuntime = 0,
     kFromJs = 1,
@@ -196,6 +215,9 @@ class RegExpGlobalCache final {
 
  private:
   int AdvanceZeroLength(int last_index);
+  // Finds all matches at once by searching the subject in parallel.  Returns
+  // false if that failed, in which case matches are fetched batch-wise.
+  bool FetchAllInParallel();
 
   int num_matches_;
   int max_matches_;
@@ -204,6 +226,8 @@ class RegExpGlobalCache final {
   // Pointer to the last set of captures.
   int32_t* register_array_;
   int register_array_size_;
+  // Backing store of `register_array_` if the matches were found in parallel.
+  std::vector<int32_t> parallel_registers_;
   Handle<RegExpData> regexp_data_;
   Handle<String> subject_;
   Isolate* isolate_;
@@ -212,6 +236,11 @@ class RegExpGlobalCache final {
 // Caches results for specific regexp queries on the isolate. At the time of
 // writing, this is used during global calls to RegExp.prototype.exec and
 // @@split.
+//
+// The cache is set-associative with kWays entries per set, each set ordered
+// from most to least recently used. A cache that has to evict an entry grows
+// to kMaxRegExpResultsCacheSize, similar to the number-to-string cache. Caches
+// are only cleared on full GCs.
 class RegExpResultsCache final : public AllStatic {
  public:
   enum ResultsCacheType { REGEXP_MULTIPLE_INDICES, STRING_SPLIT_SUBSTRINGS };
@@ -231,7 +260,9 @@ class RegExpResultsCache final : public AllStatic {
                     ResultsCacheType type);
   static void Clear(Tagged<FixedArray> cache);
 
+  // Initial and maximum cache length. Both are powers of two.
   static constexpr int kRegExpResultsCacheSize = 0x100;
+  static constexpr int kMaxRegExpResultsCacheSize = 0x1000;
 
  private:
   static constexpr int kStringOffset = 0;
@@ -239,6 +270,15 @@ class RegExpResultsCache final : public AllStatic {
   static constexpr int kArrayOffset = 2;
   static constexpr int kLastMatchOffset = 3;
   static constexpr int kArrayEntriesPerCacheEntry = 4;
+  static constexpr int kWays = 4;
+  static constexpr int kSetLength = kWays * kArrayEntriesPerCacheEntry;
+  static_assert(kRegExpResultsCacheSize % kSetLength == 0);
+
+  // Returns the index of the first entry of the set for {key_string}.
+  static int SetStart(Tagged<FixedArray> cache, Tagged<String> key_string);
+  // Moves the entry {way} of the set starting at {set_start} to the front,
+  // shifting the more recently used entries back by one.
+  static void MoveToFront(Tagged<FixedArray> cache, int set_start, int way);
 };
 
 }  // namespace internal
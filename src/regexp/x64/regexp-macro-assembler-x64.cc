@@ -732,6 +732,77 @@ bool RegExpMacroAssemblerX64::SkipUntilBitInTableUseSimd(int advance_by) {
          CpuFeatures::IsSupported(SSSE3);
 }
 
+void RegExpMacroAssemblerX64::SkipUntilCharAnd(int cp_offset, uint32_t c,
+                                               uint32_t mask, int advance_by) {
+  DCHECK(SkipUntilCharAndUseSimd(advance_by));
+  Label cont, simd_repeat, found, scalar_repeat;
+  static constexpr int kVectorSize = 16;
+  const int kCharsPerVector = kVectorSize / char_size();
+  DCHECK_LE(advance_by, kCharsPerVector);
+
+  // Fallback to scalar version if there are less than kCharsPerVector chars
+  // left in the subject.
+  CheckPosition(cp_offset + kCharsPerVector - 1, &scalar_repeat);
+
+  // Broadcast the character and the mask to all lanes.
+  const uint64_t lanes =
+      mode_ == LATIN1 ? 0x01010101'01010101 : 0x00010001'00010001;
+  const uint32_t lane_mask = mode_ == LATIN1 ? 0xff : 0xffff;
+  XMMRegister char_vec = xmm1;
+  __ Move(r11, lanes * (c & lane_mask));
+  __ movq(char_vec, r11);
+  __ Movddup(char_vec, char_vec);
+  XMMRegister mask_vec = xmm2;
+  __ Move(r11, lanes * (mask & lane_mask));
+  __ movq(mask_vec, r11);
+  __ Movddup(mask_vec, mask_vec);
+
+  Bind(&simd_repeat);
+  // result = (input & mask) == c
+  XMMRegister result = xmm3;
+  __ Movdqu(result, Operand(rsi, rdi, times_1, cp_offset * char_size()));
+  __ Andps(result, result, mask_vec);
+  if (mode_ == LATIN1) {
+    __ Pcmpeqb(result, result, char_vec);
+  } else {
+    __ Pcmpeqw(result, result, char_vec);
+  }
+  __ Pmovmskb(r11, result);
+  __ testl(r11, r11);
+  __ j(not_zero, &found);
+
+  // Checking every position is never worse than advancing by {advance_by},
+  // as the first match is not after the position the scalar version finds.
+  AdvanceCurrentPosition(kCharsPerVector);
+  CheckPosition(cp_offset + kCharsPerVector - 1, &scalar_repeat);
+  __ jmp(&simd_repeat);
+
+  Bind(&found);
+  // Extract position. For 2-byte subjects both bytes of a matching character
+  // are set, so the offset is always even.
+  __ bsfl(r11, r11);
+  __ addq(rdi, r11);
+  __ jmp(&cont);
+
+  // Scalar version for the remaining characters.
+  Bind(&scalar_repeat);
+  CheckPosition(cp_offset, &cont);
+  LoadCurrentCharacterUnchecked(cp_offset, 1);
+  CheckCharacterAfterAnd(c, mask, &cont);
+  AdvanceCurrentPosition(advance_by);
+  __ jmp(&scalar_repeat);
+
+  __ bind(&cont);
+}
+
+bool RegExpMacroAssemblerX64::SkipUntilCharAndUseSimd(int advance_by) {
+  // As for SkipUntilBitInTable, we only use SIMD instead of the scalar version
+  // if we advance by 1 byte in each iteration. For higher values the scalar
+  // version already skips most of the subject. movddup requires SSE3.
+  return v8_flags.regexp_simd && advance_by * char_size() == 1 &&
+         CpuFeatures::IsSupported(SSE3);
+}
+
 bool RegExpMacroAssemblerX64::CheckSpecialClassRanges(StandardCharacterSet type,
                                                       Label* on_no_match) {
   // Range checks (c in min..max) are generally implemented by an unsigned
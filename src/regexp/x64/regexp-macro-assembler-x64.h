@@ -57,6 +57,9 @@ class V8_EXPORT_PRIVATE RegExpMacroAssemblerX64
                            Handle<ByteArray> nibble_table,
                            int advance_by) override;
   bool SkipUntilBitInTableUseSimd(int advance_by) override;
+  void SkipUntilCharAnd(int cp_offset, uint32_t c, uint32_t mask,
+                        int advance_by) override;
+  bool SkipUntilCharAndUseSimd(int advance_by) override;
 
   // Checks whether the given offset from the current position is before
   // the end of the string.
@@ -1714,6 +1714,13 @@ RUNTIME_FUNCTION(Runtime_RegexpHasNativeCode) {
     Tagged<RegExpData> data = regexp->data(isolate);
     if (data->type_tag() == RegExpData::Type::IRREGEXP) {
       result = Cast<IrRegExpData>(data)->has_code(is_latin1);
+    } else if (data->type_tag() == RegExpData::Type::EXPERIMENTAL) {
+      // Experimental regexps have native code after tier-up only; before
+      // that, the code slots hold the trampoline to the interpreter.
+      Tagged<IrRegExpData> ir_data = Cast<IrRegExpData>(data);
+      result = ir_data->has_code(is_latin1) &&
+               ir_data->code(isolate, is_latin1)->builtin_id() !=
+                   Builtin::kRegExpExperimentalTrampoline;
     }
   }
   return isolate->heap()->ToBoolean(result);
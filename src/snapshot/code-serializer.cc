@@ -16,6 +16,7 @@
 #include "src/handles/persistent-handles.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/parked-scope.h"
+#include "src/interpreter/bytecode-array-iterator.h"
 #include "src/logging/counters-scopes.h"
 #include "src/logging/log.h"
 #include "src/logging/runtime-call-stats-scope.h"
@@ -23,6 +24,7 @@
 #include "src/objects/shared-function-info.h"
 #include "src/objects/slots.h"
 #include "src/objects/visitors.h"
+#include "src/regexp/regexp-bytecode-cache.h"
 #include "src/snapshot/object-deserializer.h"
 #include "src/snapshot/snapshot-utils.h"
 #include "src/snapshot/snapshot.h"
@@ -42,6 +44,44 @@ AlignedCachedData::AlignedCachedData(const uint8_t* data, int length)
   }
 }
 
+namespace {
+
+// Returns the pattern and flags of the regexp literals in the compiled
+// functions of `script`.
+std::vector<std::pair<Tagged<String>, int>> CollectRegExpLiterals(
+    Isolate* isolate, Tagged<Script> script) {
+  std::vector<std::pair<Tagged<String>, int>> literals;
+  SharedFunctionInfo::ScriptIterator iter(isolate, script);
+  for (Tagged<SharedFunctionInfo> info = iter.Next(); !info.is_null();
+       info = iter.Next()) {
+    if (!info->HasBytecodeArray()) continue;
+    interpreter::BytecodeArrayIterator it(
+        handle(info->GetBytecodeArray(isolate), isolate));
+    for (; !it.done(); it.Advance()) {
+      if (it.current_bytecode() !=
+          interpreter::Bytecode::kCreateRegExpLiteral) {
+        continue;
+      }
+      literals.emplace_back(
+          Cast<String>(*it.GetConstantForIndexOperand(0, isolate)),
+          static_cast<int>(it.GetFlag16Operand(2)));
+    }
+  }
+  return literals;
+}
+
+// Regexp bytecode in the code cache is only used to warm up the process-wide
+// cache, so malformed data is ignored.
+void DeserializeRegExpBytecode(const SerializedCodeData& scd) {
+  base::Vector<const uint8_t> regexp_bytecode = scd.RegExpBytecode();
+  if (regexp_bytecode.empty() || !v8_flags.regexp_shared_bytecode_cache) {
+    return;
+  }
+  USE(RegExpBytecodeCache::Deserialize(regexp_bytecode));
+}
+
+}  // namespace
+
 CodeSerializer::CodeSerializer(Isolate* isolate, uint32_t source_hash)
     : Serializer(isolate, Snapshot::kDefaultSerializerFlags),
       source_hash_(source_hash) {}
@@ -102,7 +142,15 @@ AlignedCachedData* CodeSerializer::SerializeSharedFunctionInfo(
   SerializeDeferredObjects();
   Pad();
 
-  SerializedCodeData data(sink_.data(), this);
+  std::vector<uint8_t> regexp_bytecode;
+  if (v8_flags.regexp_bytecode_in_code_cache) {
+    RegExpBytecodeCache::Serialize(
+        CollectRegExpLiterals(isolate(), Cast<Script>(info->script())),
+        &regexp_bytecode);
+    regexp_bytecode.resize(RoundUp(regexp_bytecode.size(), kPointerAlignment));
+  }
+
+  SerializedCodeData data(sink_.data(), &regexp_bytecode, this);
 
   return data.GetScriptData();
 }
@@ -477,6 +525,8 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
     return MaybeHandle<SharedFunctionInfo>();
   }
 
+  DeserializeRegExpBytecode(scd);
+
   // Deserialize.
   MaybeHandle<SharedFunctionInfo> maybe_result =
       ObjectDeserializer::DeserializeSharedFunctionInfo(isolate, &scd, source);
@@ -553,6 +603,8 @@ CodeSerializer::StartDeserializeOffThread(LocalIsolate* local_isolate,
     return result;
   }
 
+  DeserializeRegExpBytecode(scd);
+
   MaybeHandle<SharedFunctionInfo> local_maybe_result =
       OffThreadObjectDeserializer::DeserializeSharedFunctionInfo(
           local_isolate, &scd, &result.scripts);
@@ -667,12 +719,14 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::FinishOffThreadDeserialize(
   return scope.CloseAndEscape(result);
 }
 
-SerializedCodeData::SerializedCodeData(const std::vector<uint8_t>* payload,
-                                       const CodeSerializer* cs) {
+SerializedCodeData::SerializedCodeData(
+    const std::vector<uint8_t>* payload,
+    const std::vector<uint8_t>* regexp_bytecode, const CodeSerializer* cs) {
   DisallowGarbageCollection no_gc;
 
   // Calculate sizes.
-  uint32_t size = kHeaderSize + static_cast<uint32_t>(payload->size());
+  uint32_t size = kHeaderSize + static_cast<uint32_t>(payload->size()) +
+                  static_cast<uint32_t>(regexp_bytecode->size());
   DCHECK(IsAligned(size, kPointerAlignment));
 
   // Allocate backing store and create result data.
@@ -690,6 +744,8 @@ SerializedCodeData::SerializedCodeData(const std::vector<uint8_t>* payload,
                  Snapshot::ExtractReadOnlySnapshotChecksum(
                      cs->isolate()->snapshot_blob()));
   SetHeaderValue(kPayloadLengthOffset, static_cast<uint32_t>(payload->size()));
+  SetHeaderValue(kRegExpBytecodeLengthOffset,
+                 static_cast<uint32_t>(regexp_bytecode->size()));
 
   // Zero out any padding in the header.
   memset(data_ + kUnalignedHeaderSize, 0, kHeaderSize - kUnalignedHeaderSize);
@@ -697,6 +753,8 @@ SerializedCodeData::SerializedCodeData(const std::vector<uint8_t>* payload,
   // Copy serialized data.
   CopyBytes(data_ + kHeaderSize, payload->data(),
             static_cast<size_t>(payload->size()));
+  CopyBytes(data_ + kHeaderSize + payload->size(), regexp_bytecode->data(),
+            regexp_bytecode->size());
   uint32_t checksum =
       v8_flags.verify_snapshot_checksum ? Checksum(ChecksummedContent()) : 0;
   SetHeaderValue(kChecksumOffset, checksum);
@@ -743,8 +801,10 @@ SerializedCodeSanityCheckResult SerializedCodeData::SanityCheckWithoutSource(
     return SerializedCodeSanityCheckResult::kReadOnlySnapshotChecksumMismatch;
   }
   uint32_t payload_length = GetHeaderValue(kPayloadLengthOffset);
+  uint32_t regexp_bytecode_length = GetHeaderValue(kRegExpBytecodeLengthOffset);
   uint32_t max_payload_length = size_ - kHeaderSize;
-  if (payload_length > max_payload_length) {
+  if (payload_length > max_payload_length ||
+      regexp_bytecode_length > max_payload_length - payload_length) {
     return SerializedCodeSanityCheckResult::kLengthMismatch;
   }
   if (v8_flags.verify_snapshot_checksum) {
@@ -781,10 +841,19 @@ base::Vector<const uint8_t> SerializedCodeData::Payload() const {
   const uint8_t* payload = data_ + kHeaderSize;
   DCHECK(IsAligned(reinterpret_cast<intptr_t>(payload), kPointerAlignment));
   int length = GetHeaderValue(kPayloadLengthOffset);
-  DCHECK_EQ(data_ + size_, payload + length);
+  DCHECK_EQ(data_ + size_,
+            payload + length + GetHeaderValue(kRegExpBytecodeLengthOffset));
   return base::Vector<const uint8_t>(payload, length);
 }
 
+base::Vector<const uint8_t> SerializedCodeData::RegExpBytecode() const {
+  const uint8_t* regexp_bytecode =
+      data_ + kHeaderSize + GetHeaderValue(kPayloadLengthOffset);
+  int length = GetHeaderValue(kRegExpBytecodeLengthOffset);
+  DCHECK_EQ(data_ + size_, regexp_bytecode + length);
+  return base::Vector<const uint8_t>(regexp_bytecode, length);
+}
+
 SerializedCodeData::SerializedCodeData(AlignedCachedData* data)
     : SerializedData(const_cast<uint8_t*>(data->data()), data->length()) {}
 
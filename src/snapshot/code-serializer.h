@@ -122,7 +122,10 @@ class SerializedCodeData : public SerializedData {
       kFlagHashOffset + kUInt32Size;
   static const uint32_t kPayloadLengthOffset =
       kReadOnlySnapshotChecksumOffset + kUInt32Size;
-  static const uint32_t kChecksumOffset = kPayloadLengthOffset + kUInt32Size;
+  static const uint32_t kRegExpBytecodeLengthOffset =
+      kPayloadLengthOffset + kUInt32Size;
+  static const uint32_t kChecksumOffset =
+      kRegExpBytecodeLengthOffset + kUInt32Size;
   static const uint32_t kUnalignedHeaderSize = kChecksumOffset + kUInt32Size;
   static const uint32_t kHeaderSize = POINTER_SIZE_ALIGN(kUnalignedHeaderSize);
 
@@ -143,14 +146,17 @@ class SerializedCodeData : public SerializedData {
       AlignedCachedData* cached_data, uint32_t expected_source_hash,
       SerializedCodeSanityCheckResult* rejection_result);
 
-  // Used when producing.
+  // Used when producing. The bytecode of the script's regexp literals (see
+  // RegExpBytecodeCache) is stored after the payload.
   SerializedCodeData(const std::vector<uint8_t>* payload,
+                     const std::vector<uint8_t>* regexp_bytecode,
                      const CodeSerializer* cs);
 
   // Return ScriptData object and relinquish ownership over it to the caller.
   AlignedCachedData* GetScriptData();
 
   base::Vector<const uint8_t> Payload() const;
+  base::Vector<const uint8_t> RegExpBytecode() const;
 
   static uint32_t SourceHash(DirectHandle<String> source,
                              ScriptOriginOptions origin_options);
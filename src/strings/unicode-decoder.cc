@@ -4,9 +4,17 @@
 
 #include "src/strings/unicode-decoder.h"
 
+#include "src/base/bits.h"
+#include "src/base/build_config.h"
 #include "src/strings/unicode-inl.h"
 #include "src/utils/memcopy.h"
 
+#if V8_HOST_ARCH_X64
+#include <emmintrin.h>
+#elif V8_HOST_ARCH_ARM64
+#include <arm_neon.h>
+#endif
+
 #if V8_ENABLE_WEBASSEMBLY
 #include "src/third_party/utf8-decoder/generalized-utf8-decoder.h"
 #endif
@@ -14,7 +22,127 @@
 namespace v8 {
 namespace internal {
 
+int NonAsciiStartBlocks(const uint8_t* chars, int length) {
+  DCHECK_GE(length, kNonAsciiStartBlockSize);
+  const uint8_t* start = chars;
+  const uint8_t* limit = chars + length;
+  static_assert(unibrow::Utf8::kMaxOneByteChar == 0x7F);
+#if V8_HOST_ARCH_X64
+  static_assert(kNonAsciiStartBlockSize == 2 * sizeof(__m128i));
+  while (chars + kNonAsciiStartBlockSize <= limit) {
+    __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars));
+    __m128i high =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + 16));
+    // One bit per byte, set if the byte is not ASCII.
+    uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(low)) |
+                    (static_cast<uint32_t>(_mm_movemask_epi8(high)) << 16);
+    if (mask != 0) {
+      return static_cast<int>(chars - start) +
+             base::bits::CountTrailingZeros(mask);
+    }
+    chars += kNonAsciiStartBlockSize;
+  }
+#elif V8_HOST_ARCH_ARM64
+  static_assert(kNonAsciiStartBlockSize == 2 * sizeof(uint8x16_t));
+  while (chars + kNonAsciiStartBlockSize <= limit) {
+    uint8x16_t block = vorrq_u8(vld1q_u8(chars), vld1q_u8(chars + 16));
+    // NonAsciiStartWords finds the first non-ASCII byte in the block.
+    if (vmaxvq_u8(block) > unibrow::Utf8::kMaxOneByteChar) break;
+    chars += kNonAsciiStartBlockSize;
+  }
+#endif
+  return static_cast<int>(chars - start) +
+         NonAsciiStartWords(chars, static_cast<int>(limit - chars));
+}
+
+int NonAsciiStartBlocks(const uint16_t* chars, int length) {
+  constexpr int kBlockLength =
+      kNonAsciiStartBlockSize / static_cast<int>(sizeof(uint16_t));
+  DCHECK_GE(length, kBlockLength);
+  const uint16_t* start = chars;
+  const uint16_t* limit = chars + length;
+  static_assert(unibrow::Utf8::kMaxOneByteChar == 0x7F);
+#if V8_HOST_ARCH_X64
+  static_assert(kNonAsciiStartBlockSize == 2 * sizeof(__m128i));
+  const __m128i non_ascii_bits = _mm_set1_epi16(static_cast<int16_t>(0xFF80));
+  const __m128i zero = _mm_setzero_si128();
+  while (chars + kBlockLength <= limit) {
+    __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars));
+    __m128i high =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + 8));
+    // Two bits per code unit, set if the code unit is ASCII.
+    uint32_t ascii_mask =
+        static_cast<uint32_t>(_mm_movemask_epi8(
+            _mm_cmpeq_epi16(_mm_and_si128(low, non_ascii_bits), zero))) |
+        (static_cast<uint32_t>(_mm_movemask_epi8(
+             _mm_cmpeq_epi16(_mm_and_si128(high, non_ascii_bits), zero)))
+         << 16);
+    if (ascii_mask != 0xFFFFFFFF) {
+      return static_cast<int>(chars - start) +
+             base::bits::CountTrailingZeros(~ascii_mask) / 2;
+    }
+    chars += kBlockLength;
+  }
+#elif V8_HOST_ARCH_ARM64
+  static_assert(kNonAsciiStartBlockSize == 2 * sizeof(uint16x8_t));
+  while (chars + kBlockLength <= limit) {
+    uint16x8_t block = vorrq_u16(vld1q_u16(chars), vld1q_u16(chars + 8));
+    // The loop below finds the first non-ASCII code unit in the block.
+    if (vmaxvq_u16(block) > unibrow::Utf8::kMaxOneByteChar) break;
+    chars += kBlockLength;
+  }
+#endif
+  while (chars < limit && *chars <= unibrow::Utf8::kMaxOneByteChar) ++chars;
+  return static_cast<int>(chars - start);
+}
+
 namespace {
+
+// Decodes a two- or three-byte sequence at `cursor` that every decoder accepts
+// and that can't be part of a surrogate pair, without going through the DFA.
+// This covers all of Latin-1 and most of the BMP, e.g. CJK. Returns the length
+// of the sequence, or 0 if the DFA has to decode it.
+inline int DecodeCommonSequence(const uint8_t* cursor, const uint8_t* end,
+                                uint32_t* code_point) {
+  auto is_continuation = [](uint8_t byte) { return (byte & 0xC0) == 0x80; };
+  const uint8_t lead = cursor[0];
+  if (lead >= 0xC2 && lead <= 0xDF) {
+    if (end - cursor < 2 || !is_continuation(cursor[1])) return 0;
+    *code_point = ((lead & 0x1F) << 6) | (cursor[1] & 0x3F);
+    return 2;
+  }
+  // E0 and ED have restricted second bytes, to exclude overlong encodings and
+  // surrogates respectively.
+  if (lead >= 0xE1 && lead <= 0xEF && lead != 0xED) {
+    if (end - cursor < 3 || !is_continuation(cursor[1]) ||
+        !is_continuation(cursor[2])) {
+      return 0;
+    }
+    *code_point =
+        ((lead & 0x0F) << 12) | ((cursor[1] & 0x3F) << 6) | (cursor[2] & 0x3F);
+    return 3;
+  }
+  return 0;
+}
+
+// Returns the length of the run of ASCII characters starting at `cursor`,
+// which has to point to an ASCII character. Short runs, e.g. spaces between
+// non-ASCII words, are common enough to not pay for a bulk scan.
+constexpr int kShortAsciiRunLength = 8;
+
+inline int AsciiRunLength(const uint8_t* cursor, const uint8_t* end) {
+  DCHECK_LE(*cursor, unibrow::Utf8::kMaxOneByteChar);
+  const uint8_t* run_end = cursor + 1;
+  for (int i = 0; i < kShortAsciiRunLength && run_end < end; i++) {
+    if (*run_end > unibrow::Utf8::kMaxOneByteChar) {
+      return static_cast<int>(run_end - cursor);
+    }
+    run_end++;
+  }
+  return static_cast<int>(run_end - cursor) +
+         NonAsciiStart(run_end, static_cast<int>(end - run_end));
+}
+
 template <class Decoder>
 struct DecoderTraits;
 
@@ -76,12 +204,28 @@ Utf8DecoderBase<Decoder>::Utf8DecoderBase(base::Vector<const uint8_t> data)
                   state == Traits::DfaDecoder::kAccept)) {
       DCHECK_EQ(0u, current);
       DCHECK(!Traits::IsInvalidSurrogatePair(previous, *cursor));
-      previous = *cursor;
-      utf16_length_++;
-      cursor++;
+      // Skip the rest of the ASCII run in bulk.
+      int ascii_length = AsciiRunLength(cursor, end);
+      utf16_length_ += ascii_length;
+      cursor += ascii_length;
+      previous = cursor[-1];
       continue;
     }
 
+    if (state == Traits::DfaDecoder::kAccept) {
+      DCHECK_EQ(0u, current);
+      uint32_t code_point;
+      int sequence_length = DecodeCommonSequence(cursor, end, &code_point);
+      if (sequence_length != 0) {
+        DCHECK(!Traits::IsInvalidSurrogatePair(previous, code_point));
+        is_one_byte = is_one_byte && code_point <= unibrow::Latin1::kMaxChar;
+        utf16_length_++;
+        previous = code_point;
+        cursor += sequence_length;
+        continue;
+      }
+    }
+
     auto previous_state = state;
     Traits::DfaDecoder::Decode(*cursor, &state, &current);
     if (state < Traits::DfaDecoder::kAccept) {
@@ -144,11 +288,24 @@ void Utf8DecoderBase<Decoder>::Decode(Char* out,
     if (V8_LIKELY(*cursor <= unibrow::Utf8::kMaxOneByteChar &&
                   state == Traits::DfaDecoder::kAccept)) {
       DCHECK_EQ(0u, current);
-      *(out++) = static_cast<Char>(*cursor);
-      cursor++;
+      int ascii_length = AsciiRunLength(cursor, end);
+      CopyChars(out, cursor, ascii_length);
+      out += ascii_length;
+      cursor += ascii_length;
       continue;
     }
 
+    if (state == Traits::DfaDecoder::kAccept) {
+      uint32_t code_point;
+      int sequence_length = DecodeCommonSequence(cursor, end, &code_point);
+      if (sequence_length != 0) {
+        DCHECK(sizeof(Char) == 2 || code_point <= unibrow::Latin1::kMaxChar);
+        *(out++) = static_cast<Char>(code_point);
+        cursor += sequence_length;
+        continue;
+      }
+    }
+
     auto previous_state = state;
     Traits::DfaDecoder::Decode(*cursor, &state, &current);
     if (Traits::kAllowIncompleteSequences &&
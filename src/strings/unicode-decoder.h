@@ -11,11 +11,17 @@
 namespace v8 {
 namespace internal {
 
+// Strings of at least this many bytes are scanned with SIMD instructions, a
+// block of kNonAsciiStartBlockSize bytes at a time, if the host supports it.
+constexpr int kNonAsciiStartBlockSize = 32;
+
+V8_EXPORT_PRIVATE int NonAsciiStartBlocks(const uint8_t* chars, int length);
+
 // The return value may point to the first aligned word containing the first
 // non-one-byte character, rather than directly to the non-one-byte character.
 // If the return value is >= the passed length, the entire string was
 // one-byte.
-inline int NonAsciiStart(const uint8_t* chars, int length) {
+inline int NonAsciiStartWords(const uint8_t* chars, int length) {
   const uint8_t* start = chars;
   const uint8_t* limit = chars + length;
 
@@ -48,6 +54,28 @@ inline int NonAsciiStart(const uint8_t* chars, int length) {
   return static_cast<int>(chars - start);
 }
 
+// Like NonAsciiStartWords, but long strings are scanned in blocks.
+inline int NonAsciiStart(const uint8_t* chars, int length) {
+  if (length >= kNonAsciiStartBlockSize) {
+    return NonAsciiStartBlocks(chars, length);
+  }
+  return NonAsciiStartWords(chars, length);
+}
+
+V8_EXPORT_PRIVATE int NonAsciiStartBlocks(const uint16_t* chars, int length);
+
+// Returns the index of the first non-ASCII UTF-16 code unit, or `length` if
+// all code units are ASCII. Unlike the one-byte version, the result is exact.
+inline int NonAsciiStart(const uint16_t* chars, int length) {
+  constexpr int kBlockLength =
+      kNonAsciiStartBlockSize / static_cast<int>(sizeof(uint16_t));
+  if (length >= kBlockLength) return NonAsciiStartBlocks(chars, length);
+  for (int i = 0; i < length; i++) {
+    if (chars[i] > unibrow::Utf8::kMaxOneByteChar) return i;
+  }
+  return length;
+}
+
 template <class Decoder>
 class Utf8DecoderBase {
  public:
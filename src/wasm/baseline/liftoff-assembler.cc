@@ -12,6 +12,7 @@
 #include "src/codegen/macro-assembler-inl.h"
 #include "src/compiler/linkage.h"
 #include "src/compiler/wasm-compiler.h"
+#include "src/utils/bit-vector.h"
 #include "src/utils/ostreams.h"
 #include "src/wasm/baseline/liftoff-assembler-inl.h"
 #include "src/wasm/baseline/liftoff-register.h"
@@ -651,6 +652,34 @@ void LiftoffAssembler::SpillLocals() {
   }
 }
 
+void LiftoffAssembler::SpillLoopCarriedLocals(
+    const BitVector& assigned_locals) {
+  // Keep at most half of the cache registers of each class occupied by
+  // loop-invariant locals, to leave room for the values of the loop body.
+  constexpr uint32_t kMaxKeptGpRegs = kGpCacheRegList.GetNumRegsSet() / 2;
+  constexpr uint32_t kMaxKeptFpRegs = kFpCacheRegList.GetNumRegsSet() / 2;
+  uint32_t kept_gp_regs = 0;
+  uint32_t kept_fp_regs = 0;
+  for (uint32_t i = 0; i < num_locals_; ++i) {
+    VarState& local_slot = cache_state_.stack_state[i];
+    // A register shared with another value can't be used for the loop merge.
+    // Register pairs are spilled for simplicity.
+    if (local_slot.is_reg() && !assigned_locals.Contains(i) &&
+        !local_slot.reg().is_pair() &&
+        cache_state_.get_use_count(local_slot.reg()) == 1) {
+      uint32_t& kept_regs =
+          local_slot.reg().is_gp() ? kept_gp_regs : kept_fp_regs;
+      uint32_t max_kept_regs =
+          local_slot.reg().is_gp() ? kMaxKeptGpRegs : kMaxKeptFpRegs;
+      if (kept_regs < max_kept_regs) {
+        ++kept_regs;
+        continue;
+      }
+    }
+    Spill(&local_slot);
+  }
+}
+
 void LiftoffAssembler::SpillAllRegisters() {
   for (VarState& slot : cache_state_.stack_state) {
     if (!slot.is_reg()) continue;
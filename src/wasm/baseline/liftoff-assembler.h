@@ -20,6 +20,10 @@
 #include "src/wasm/wasm-value.h"
 
 // Forward declarations.
+namespace v8::internal {
+class BitVector;
+}  // namespace v8::internal
+
 namespace v8::internal::compiler {
 class CallDescriptor;
 }  // namespace v8::internal::compiler
@@ -564,6 +568,10 @@ class LiftoffAssembler : public MacroAssembler {
 
   void Spill(VarState* slot);
   void SpillLocals();
+  // Spills the locals in {assigned_locals} (the locals assigned inside a loop),
+  // and keeps the other locals in their registers if that leaves enough
+  // registers for the loop body.
+  void SpillLoopCarriedLocals(const BitVector& assigned_locals);
   void SpillAllRegisters();
   inline void LoadSpillAddress(Register dst, int offset, ValueKind kind);
 
@@ -1407,9 +1407,19 @@ class LiftoffCompiler {
     // Before entering a loop, spill all locals to the stack, in order to free
     // the cache registers, and to avoid unnecessarily reloading stack values
     // into registers at branches.
-    // TODO(clemensb): Come up with a better strategy here, involving
-    // pre-analysis of the function.
-    __ SpillLocals();
+    // With {--liftoff-loop-analysis}, a pre-pass over the loop body finds the
+    // locals assigned in the loop; only those are spilled, and loop-invariant
+    // locals can stay in registers for the whole loop.
+    BitVector* assigned_locals = nullptr;
+    if (v8_flags.liftoff_loop_analysis && for_debugging_ == kNotForDebugging) {
+      assigned_locals = WasmDecoder<ValidationTag>::AnalyzeLoopAssignment(
+          decoder, decoder->pc(), __ num_locals(), decoder->zone());
+    }
+    if (assigned_locals) {
+      __ SpillLoopCarriedLocals(*assigned_locals);
+    } else {
+      __ SpillLocals();
+    }
 
     __ SpillLoopArgs(loop->start_merge.arity);
 
@@ -29,6 +29,7 @@ class Counters;
 namespace wasm {
 
 class NativeModule;
+class ProfileInformation;
 class WasmCode;
 class WasmEngine;
 class WasmError;
@@ -164,6 +165,11 @@ class V8_EXPORT_PRIVATE CompilationState {
 
   void TierUpAllFunctions();
 
+  // Schedules background compilation of the functions that were executed or
+  // tiered up according to {pgo_info}. Can be called after initial
+  // compilation.
+  void ApplyPgoInfo(ProfileInformation* pgo_info);
+
   // By default, only one top-tier compilation task will be executed for each
   // function. These functions allow resetting that counter, to be used when
   // optimized code is intentionally thrown away and should be re-created.
@@ -628,6 +628,10 @@ class CompilationStateImpl {
   void CommitTopTierCompilationUnit(WasmCompilationUnit);
   void AddTopTierPriorityCompilationUnit(WasmCompilationUnit, size_t);
 
+  // Schedules baseline compilation of all lazy functions that were not
+  // compiled yet. Only has an effect on the first call.
+  void CompileLazyFunctionsInBackground();
+
   CompilationUnitQueues::Queue* GetQueueForCompileTask(int task_id);
 
   std::optional<WasmCompilationUnit> GetNextCompilationUnit(
@@ -666,6 +670,11 @@ class CompilationStateImpl {
     return outstanding_baseline_units_ == 0;
   }
 
+  int num_baseline_compiled_functions() const {
+    base::MutexGuard guard(&callbacks_mutex_);
+    return num_baseline_compiled_functions_;
+  }
+
   DynamicTiering dynamic_tiering() const { return dynamic_tiering_; }
 
   Counters* counters() const { return async_counters_.get(); }
@@ -726,6 +735,10 @@ class CompilationStateImpl {
   // flag can be updated and read using relaxed semantics.
   std::atomic<bool> compile_cancelled_{false};
 
+  // True once the lazy functions were scheduled for background compilation
+  // (see {CompileLazyFunctionsInBackground}).
+  std::atomic<bool> lazy_functions_scheduled_{false};
+
   CompilationUnitQueues compilation_unit_queues_;
 
   // Cache the dynamic tiering configuration to be consistent for the whole
@@ -775,6 +788,8 @@ class CompilationStateImpl {
   base::EnumSet<CompilationEvent> finished_events_;
 
   int outstanding_baseline_units_ = 0;
+  // The number of functions which reached their required baseline tier.
+  int num_baseline_compiled_functions_ = 0;
   // The amount of generated top tier code since the last
   // {kFinishedCompilationChunk} event.
   size_t bytes_since_last_chunk_ = 0;
@@ -892,6 +907,12 @@ void CompilationState::TierUpAllFunctions() {
   Impl(this)->TierUpAllFunctions();
 }
 
+void CompilationState::ApplyPgoInfo(ProfileInformation* pgo_info) {
+  // Without a compiler there is nothing to schedule.
+  if (v8_flags.wasm_jitless) return;
+  Impl(this)->ApplyPgoInfoLate(pgo_info);
+}
+
 void CompilationState::AllowAnotherTopTierJob(uint32_t func_index) {
   Impl(this)->AllowAnotherTopTierJob(func_index);
 }
@@ -1219,6 +1240,15 @@ bool CompileLazy(Isolate* isolate,
   return true;
 }
 
+void CompileLazyFunctionsInBackground(NativeModule* native_module) {
+  // Without upfront validation, background compilation could hit a validation
+  // error that would otherwise only be reported when calling the function.
+  if (v8_flags.wasm_jitless || v8_flags.wasm_lazy_validation) return;
+  if (!IsLazyModule(native_module->module())) return;
+  if (native_module->module()->origin != kWasmOrigin) return;
+  Impl(native_module->compilation_state())->CompileLazyFunctionsInBackground();
+}
+
 void ThrowLazyCompilationError(Isolate* isolate,
                                const NativeModule* native_module,
                                int func_index) {
@@ -2453,6 +2483,8 @@ class AsyncStreamingProcessor final : public StreamingProcessor {
 
   void OnFinishedChunk() override;
 
+  int NumCompiledFunctions() const override;
+
   void OnFinishedStream(base::OwnedVector<const uint8_t> bytes,
                         bool after_error) override;
 
@@ -2468,6 +2500,9 @@ class AsyncStreamingProcessor final : public StreamingProcessor {
   AsyncCompileJob* job_;
   std::unique_ptr<CompilationUnitBuilder> compilation_unit_builder_;
   int num_functions_ = 0;
+  // Size of the function bodies added to {compilation_unit_builder_} since the
+  // last commit.
+  size_t uncommitted_code_size_ = 0;
   bool prefix_cache_hit_ = false;
   bool before_code_section_ = true;
   ValidateFunctionsStreamingJobData validate_functions_job_data_;
@@ -2565,7 +2600,8 @@ void AsyncCompileJob::FinishCompile(bool is_after_cache_hit) {
   // we have all wire bytes and know that the module is valid.
   if (V8_UNLIKELY(v8_flags.experimental_wasm_pgo_from_file)) {
     std::unique_ptr<ProfileInformation> pgo_info =
-        LoadProfileFromFile(module, native_module_->wire_bytes());
+        LoadProfileFromFile(module, native_module_->wire_bytes(),
+                            native_module_->enabled_features());
     if (pgo_info) {
       compilation_state->ApplyPgoInfoLate(pgo_info.get());
     }
@@ -2574,6 +2610,9 @@ void AsyncCompileJob::FinishCompile(bool is_after_cache_hit) {
   bool is_after_deserialization = !module_object_.is_null();
   if (!is_after_deserialization) {
     PrepareRuntimeObjects();
+    if (V8_UNLIKELY(v8_flags.experimental_wasm_code_cache_dir)) {
+      WriteToCodeCacheDirAfterCompilation(native_module_);
+    }
   }
 
   // Measure duration of baseline compilation or deserialization from cache.
@@ -3179,12 +3218,20 @@ bool AsyncStreamingProcessor::ProcessFunctionBody(
   auto* compilation_state = Impl(job_->native_module_->compilation_state());
   compilation_state->AddCompilationUnit(compilation_unit_builder_.get(),
                                         func_index);
+  // Units are usually committed at the end of each chunk. Commit earlier
+  // within large chunks, so that background compilation (and validation) of
+  // the first functions overlaps with decoding the rest of the chunk.
+  uncommitted_code_size_ += bytes.size();
+  if (uncommitted_code_size_ >= v8_flags.wasm_streaming_commit_size * KB) {
+    CommitCompilationUnits();
+  }
   return true;
 }
 
 void AsyncStreamingProcessor::CommitCompilationUnits() {
   DCHECK(compilation_unit_builder_);
   compilation_unit_builder_->Commit();
+  uncommitted_code_size_ = 0;
 }
 
 void AsyncStreamingProcessor::OnFinishedChunk() {
@@ -3192,6 +3239,12 @@ void AsyncStreamingProcessor::OnFinishedChunk() {
   if (compilation_unit_builder_) CommitCompilationUnits();
 }
 
+int AsyncStreamingProcessor::NumCompiledFunctions() const {
+  if (!job_->native_module_) return 0;
+  return Impl(job_->native_module_->compilation_state())
+      ->num_baseline_compiled_functions();
+}
+
 // Finish the processing of the stream.
 void AsyncStreamingProcessor::OnFinishedStream(
     base::OwnedVector<const uint8_t> bytes, bool after_error) {
@@ -3773,6 +3826,45 @@ void CompilationStateImpl::CommitTopTierCompilationUnit(
   CommitCompilationUnits({}, {&unit, 1});
 }
 
+void CompilationStateImpl::CompileLazyFunctionsInBackground() {
+  if (lazy_functions_scheduled_.exchange(true, std::memory_order_relaxed)) {
+    return;
+  }
+  if (failed() || native_module_->IsInDebugState()) return;
+
+  // Collect functions without a required baseline tier; all others are
+  // compiled (or being compiled) eagerly already.
+  std::vector<int> lazy_functions;
+  {
+    base::MutexGuard guard(&callbacks_mutex_);
+    int offset = native_module_->module()->num_imported_functions;
+    for (size_t i = 0, e = compilation_progress_.size(); i < e; ++i) {
+      uint8_t function_progress = compilation_progress_[i];
+      if (RequiredBaselineTierField::decode(function_progress) !=
+          ExecutionTier::kNone) {
+        continue;
+      }
+      lazy_functions.push_back(offset + static_cast<int>(i));
+    }
+  }
+
+  // Lazily compiled code does not update the compilation progress, so check
+  // the code table instead. This must not happen while holding the
+  // {callbacks_mutex_} (see {OnFinishedUnits}).
+  CompilationUnitBuilder builder(native_module_);
+  for (int func_index : lazy_functions) {
+    if (native_module_->HasCode(func_index)) continue;
+    ExecutionTierPair tiers =
+        GetLazyCompilationTiers(native_module_, func_index, kNotDebugging);
+    builder.AddBaselineUnit(func_index, tiers.baseline_tier);
+  }
+  TRACE_LAZY("Scheduling %zu lazy functions for background compilation.\n",
+             lazy_functions.size());
+  // The units do not contribute to {outstanding_baseline_units_}: they only
+  // publish code, exactly like lazy compilation on the main thread would.
+  builder.Commit();
+}
+
 void CompilationStateImpl::AddTopTierPriorityCompilationUnit(
     WasmCompilationUnit unit, size_t priority) {
   compilation_unit_queues_.AddTopTierPriorityUnit(unit, priority);
@@ -3844,6 +3936,7 @@ void CompilationStateImpl::OnFinishedUnits(
           required_baseline_tier <= code->tier()) {
         DCHECK_GT(outstanding_baseline_units_, 0);
         outstanding_baseline_units_--;
+        num_baseline_compiled_functions_++;
       }
       if (code->tier() == ExecutionTier::kTurbofan) {
         bytes_since_last_chunk_ += code->instructions().size();
@@ -79,6 +79,11 @@ WasmCode* CompileImportWrapperForTest(Isolate* isolate,
 // also lazy.
 bool CompileLazy(Isolate*, Tagged<WasmTrustedInstanceData>, int func_index);
 
+// Schedules baseline compilation of all not yet compiled functions of a lazy
+// module on background threads, so that calls after instantiation do not have
+// to wait for lazy compilation. Used for --wasm-lazy-background-compilation.
+void CompileLazyFunctionsInBackground(NativeModule* native_module);
+
 // Throws the compilation error after failed lazy compilation.
 void ThrowLazyCompilationError(Isolate* isolate,
                                const NativeModule* native_module,
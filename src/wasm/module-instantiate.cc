@@ -4,6 +4,8 @@
 
 #include "src/wasm/module-instantiate.h"
 
+#include <algorithm>
+
 #include "src/api/api-inl.h"
 #include "src/asmjs/asm-js.h"
 #include "src/base/atomicops.h"
@@ -20,6 +22,7 @@
 #include "src/wasm/code-space-access.h"
 #include "src/wasm/compilation-environment-inl.h"
 #include "src/wasm/constant-expression-interface.h"
+#include "src/wasm/function-body-decoder.h"
 #include "src/wasm/module-compiler.h"
 #include "src/wasm/module-decoder-impl.h"
 #include "src/wasm/pgo.h"
@@ -858,6 +861,11 @@ class InstanceBuilder {
   // Run the start function, if any.
   bool ExecuteStartFunction();
 
+  // Restore the state of {snapshot} instead of loading data segments.
+  void set_snapshot(const WasmInstanceSnapshot* snapshot) {
+    snapshot_ = snapshot;
+  }
+
  private:
   Isolate* isolate_;
   v8::metrics::Recorder::ContextId context_id_;
@@ -874,6 +882,7 @@ class InstanceBuilder {
   std::vector<Handle<WasmTagObject>> tags_wrappers_;
   std::vector<Handle<WasmTagObject>> shared_tags_wrappers_;
   Handle<JSFunction> start_function_;
+  const WasmInstanceSnapshot* snapshot_ = nullptr;
   std::vector<Handle<Object>> sanitized_imports_;
   std::vector<WellKnownImport> well_known_imports_;
   // We pass this {Zone} to the temporary {WasmFullDecoder} we allocate during
@@ -920,6 +929,9 @@ class InstanceBuilder {
       Handle<WasmTrustedInstanceData> trusted_instance_data,
       Handle<WasmTrustedInstanceData> shared_trusted_instance_data);
 
+  // Restore memories, globals and data segment sizes from {snapshot_}.
+  void ApplySnapshot(Handle<WasmTrustedInstanceData> trusted_instance_data);
+
   void WriteGlobalValue(const WasmGlobal& global, const WasmValue& value);
 
   void SanitizeImports();
@@ -1045,6 +1057,166 @@ MaybeHandle<WasmInstanceObject> InstantiateToInstanceObject(
   return {};
 }
 
+namespace {
+
+// Instances created from a snapshot initialize their tables and element
+// segments from the module, so instances that could have changed them since
+// their instantiation can't be snapshotted. Own tables can be changed through
+// exports, and all tables and element segments by the respective
+// instructions.
+bool MayModifyTablesOrElementSegments(const NativeModule* native_module) {
+  const WasmModule* module = native_module->module();
+  for (const WasmTable& table : module->tables) {
+    if (!table.imported && table.exported) return true;
+  }
+  base::Vector<const uint8_t> wire_bytes = native_module->wire_bytes();
+  AccountingAllocator allocator;
+  for (uint32_t func_index = module->num_imported_functions;
+       func_index < module->functions.size(); ++func_index) {
+    const WasmFunction& func = module->functions[func_index];
+    base::Vector<const uint8_t> code =
+        wire_bytes.SubVector(func.code.offset(), func.code.end_offset());
+    Zone zone(&allocator, ZONE_NAME);
+    if (!module->function_was_validated(func_index)) {
+      bool is_shared = module->types[func.sig_index].is_shared;
+      FunctionBody body{func.sig, func.code.offset(), code.begin(),
+                        code.end(), is_shared};
+      WasmDetectedFeatures detected_features;
+      if (ValidateFunctionBody(&zone, native_module->enabled_features(),
+                               module, &detected_features, body)
+              .failed()) {
+        return true;
+      }
+      module->set_function_validated(func_index);
+    }
+    BodyLocalDecls locals;
+    for (BytecodeIterator it(code.begin(), code.end(), &locals, &zone);
+         it.has_next(); it.next()) {
+      WasmOpcode opcode = it.current();
+      if (WasmOpcodes::IsPrefixOpcode(opcode)) opcode = it.prefixed_opcode();
+      switch (opcode) {
+        case kExprTableSet:
+        case kExprTableGrow:
+        case kExprTableFill:
+        case kExprTableCopy:
+        case kExprTableInit:
+        case kExprElemDrop:
+          return true;
+        default:
+          break;
+      }
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+// static
+std::unique_ptr<WasmInstanceSnapshot> WasmInstanceSnapshot::Create(
+    Isolate* isolate, DirectHandle<WasmInstanceObject> instance) {
+  Tagged<WasmTrustedInstanceData> trusted_data =
+      instance->trusted_data(isolate);
+  const WasmModule* module = trusted_data->module();
+  if (module->origin != kWasmOrigin) return {};
+  for (const WasmGlobal& global : module->globals) {
+    if (global.imported) continue;
+    if (global.shared) return {};
+    if (global.mutability && global.type.is_reference()) return {};
+  }
+  for (const WasmMemory& memory : module->memories) {
+    if (!memory.imported && memory.is_shared) return {};
+  }
+  // Only own memories are restored; imported ones are whatever the new
+  // instance imports, so segments written into them would be lost.
+  for (const WasmDataSegment& segment : module->data_segments) {
+    if (segment.active && module->memories[segment.memory_index].imported) {
+      return {};
+    }
+  }
+  // The start function isn't run for instances created from a snapshot, so
+  // its effects on imported objects would be lost.
+  if (module->start_function_index >= 0) {
+    if (module->num_imported_functions > 0) return {};
+    if (module->num_imported_mutable_globals > 0) return {};
+    for (const WasmMemory& memory : module->memories) {
+      if (memory.imported) return {};
+    }
+  }
+
+  std::shared_ptr<NativeModule> native_module =
+      trusted_data->module_object()->shared_native_module();
+  if (MayModifyTablesOrElementSegments(native_module.get())) return {};
+
+  std::unique_ptr<WasmInstanceSnapshot> snapshot{new WasmInstanceSnapshot()};
+  snapshot->native_module_ = std::move(native_module);
+
+  snapshot->memories_.resize(module->memories.size());
+  for (size_t memory_index = 0; memory_index < module->memories.size();
+       ++memory_index) {
+    if (module->memories[memory_index].imported) continue;
+    MemoryContents& contents = snapshot->memories_[memory_index];
+    const int index = static_cast<int>(memory_index);
+    const uint8_t* memory_base = trusted_data->memory_base(index);
+    contents.byte_length = trusted_data->memory_size(index);
+    for (size_t offset = 0; offset < contents.byte_length;
+         offset += kChunkSize) {
+      size_t size = std::min(kChunkSize, contents.byte_length - offset);
+      const uint8_t* chunk = memory_base + offset;
+      if (std::all_of(chunk, chunk + size,
+                      [](uint8_t byte) { return byte == 0; })) {
+        continue;
+      }
+      contents.chunk_indices.push_back(
+          static_cast<uint32_t>(offset / kChunkSize));
+      contents.chunks.insert(contents.chunks.end(), chunk, chunk + size);
+    }
+  }
+
+  if (module->untagged_globals_buffer_size > 0) {
+    const uint8_t* globals_start = trusted_data->globals_start();
+    snapshot->untagged_globals_.assign(
+        globals_start, globals_start + module->untagged_globals_buffer_size);
+  }
+
+  Tagged<FixedUInt32Array> data_segment_sizes =
+      trusted_data->data_segment_sizes();
+  snapshot->data_segment_sizes_.resize(data_segment_sizes->length());
+  for (size_t i = 0; i < snapshot->data_segment_sizes_.size(); ++i) {
+    snapshot->data_segment_sizes_[i] =
+        data_segment_sizes->get(static_cast<int>(i));
+  }
+  return snapshot;
+}
+
+size_t WasmInstanceSnapshot::stored_memory_bytes() const {
+  size_t result = 0;
+  for (const MemoryContents& contents : memories_) {
+    result += contents.chunks.size();
+  }
+  return result;
+}
+
+MaybeHandle<WasmInstanceObject> InstantiateFromSnapshot(
+    Isolate* isolate, ErrorThrower* thrower,
+    Handle<WasmModuleObject> module_object, MaybeHandle<JSReceiver> imports,
+    const WasmInstanceSnapshot& snapshot) {
+  if (snapshot.native_module() != module_object->native_module()) {
+    thrower->LinkError("snapshot was created for a different module");
+    return {};
+  }
+  v8::metrics::Recorder::ContextId context_id =
+      isolate->GetOrRegisterRecorderContextId(isolate->native_context());
+  InstanceBuilder builder(isolate, context_id, thrower, module_object, imports,
+                          {});
+  builder.set_snapshot(&snapshot);
+  // The start function already ran when the snapshot was taken.
+  MaybeHandle<WasmInstanceObject> instance_object = builder.Build();
+  DCHECK_IMPLIES(instance_object.is_null(),
+                 isolate->has_exception() || thrower->error());
+  return instance_object;
+}
+
 InstanceBuilder::InstanceBuilder(Isolate* isolate,
                                  v8::metrics::Recorder::ContextId context_id,
                                  ErrorThrower* thrower,
@@ -1465,7 +1637,10 @@ MaybeHandle<WasmInstanceObject> InstanceBuilder::Build() {
   //--------------------------------------------------------------------------
   // Initialize the memory by loading data segments.
   //--------------------------------------------------------------------------
-  if (!module_->data_segments.empty()) {
+  if (snapshot_ != nullptr) {
+    ApplySnapshot(trusted_data);
+    if (thrower_->error()) return {};
+  } else if (!module_->data_segments.empty()) {
     LoadDataSegments(trusted_data, shared_trusted_data);
     if (thrower_->error()) return {};
   }
@@ -1503,6 +1678,13 @@ MaybeHandle<WasmInstanceObject> InstanceBuilder::Build() {
     }
   }
 
+  //--------------------------------------------------------------------------
+  // Compile the remaining functions of lazy modules in the background.
+  //--------------------------------------------------------------------------
+  if (V8_UNLIKELY(v8_flags.wasm_lazy_background_compilation)) {
+    CompileLazyFunctionsInBackground(module_object_->native_module());
+  }
+
   DCHECK(!isolate_->has_exception());
   TRACE("Successfully built instance for module %p\n",
         module_object_->native_module());
@@ -1728,6 +1910,81 @@ void InstanceBuilder::LoadDataSegments(
   }
 }
 
+void InstanceBuilder::ApplySnapshot(
+    Handle<WasmTrustedInstanceData> trusted_instance_data) {
+  DCHECK_NOT_NULL(snapshot_);
+  using MemoryContents = WasmInstanceSnapshot::MemoryContents;
+  constexpr size_t kChunkSize = WasmInstanceSnapshot::kChunkSize;
+
+  // Data segment offsets and initializers of globals may read imported
+  // immutable globals. The snapshot holds the results for the values imported
+  // when it was created, so the imports have to provide the same values.
+  for (size_t global_index = 0; global_index < module_->globals.size();
+       ++global_index) {
+    const WasmGlobal& global = module_->globals[global_index];
+    if (!global.imported || global.mutability || !global.type.is_numeric()) {
+      continue;
+    }
+    if (std::memcmp(GetRawUntaggedGlobalPtr<uint8_t>(global),
+                    snapshot_->untagged_globals_.data() + global.offset,
+                    global.type.value_kind_size()) != 0) {
+      thrower_->LinkError(
+          "imported global %zu has a different value than in the snapshot",
+          global_index);
+      return;
+    }
+  }
+
+  for (size_t memory_index = 0; memory_index < module_->memories.size();
+       ++memory_index) {
+    if (module_->memories[memory_index].imported) continue;
+    const MemoryContents& contents = snapshot_->memories_[memory_index];
+    const int index = static_cast<int>(memory_index);
+    // The memory may have been grown before the snapshot was taken.
+    size_t memory_size = trusted_instance_data->memory_size(index);
+    DCHECK_LE(memory_size, contents.byte_length);
+    if (memory_size < contents.byte_length) {
+      Handle<WasmMemoryObject> memory_object{
+          trusted_instance_data->memory_object(index), isolate_};
+      uint32_t delta_pages = static_cast<uint32_t>(
+          (contents.byte_length - memory_size) / kWasmPageSize);
+      if (WasmMemoryObject::Grow(isolate_, memory_object, delta_pages) < 0) {
+        thrower_->RangeError("Out of memory: cannot restore memory %zu",
+                             memory_index);
+        return;
+      }
+    }
+    // Fresh memory is zero, so only the non-zero chunks need to be copied.
+    uint8_t* memory_base = trusted_instance_data->memory_base(index);
+    const uint8_t* chunk = contents.chunks.data();
+    for (uint32_t chunk_index : contents.chunk_indices) {
+      size_t offset = size_t{chunk_index} * kChunkSize;
+      size_t size = std::min(kChunkSize, contents.byte_length - offset);
+      std::memcpy(memory_base + offset, chunk, size);
+      chunk += size;
+    }
+  }
+
+  // Imported globals are provided by the imports (and checked above),
+  // reference-typed globals are immutable and have already been initialized.
+  for (const WasmGlobal& global : module_->globals) {
+    if (global.imported || !global.type.is_numeric()) continue;
+    DCHECK(!global.shared);
+    std::memcpy(GetRawUntaggedGlobalPtr<uint8_t>(global),
+                snapshot_->untagged_globals_.data() + global.offset,
+                global.type.value_kind_size());
+  }
+
+  Tagged<FixedUInt32Array> data_segment_sizes =
+      trusted_instance_data->data_segment_sizes();
+  DCHECK_EQ(snapshot_->data_segment_sizes_.size(),
+            static_cast<size_t>(data_segment_sizes->length()));
+  for (size_t i = 0; i < snapshot_->data_segment_sizes_.size(); ++i) {
+    data_segment_sizes->set(static_cast<int>(i),
+                            snapshot_->data_segment_sizes_[i]);
+  }
+}
+
 void InstanceBuilder::WriteGlobalValue(const WasmGlobal& global,
                                        const WasmValue& value) {
   TRACE("init [globals_start=%p + %u] = %s, type = %s\n",
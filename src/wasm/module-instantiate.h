@@ -11,7 +11,9 @@
 
 #include <stdint.h>
 
+#include <memory>
 #include <optional>
+#include <vector>
 
 #include "src/common/message-template.h"
 #include "src/objects/code-kind.h"
@@ -31,6 +33,7 @@ class Zone;
 
 namespace wasm {
 class ErrorThrower;
+class NativeModule;
 enum Suspend : int { kSuspend, kNoSuspend };
 enum Promise : int { kPromise, kNoPromise };
 struct WasmModule;
@@ -125,6 +128,66 @@ MaybeHandle<WasmInstanceObject> InstantiateToInstanceObject(
     Handle<WasmModuleObject> module_object, MaybeHandle<JSReceiver> imports,
     MaybeHandle<JSArrayBuffer> memory);
 
+// The state of an instance after its initialization (data segments and start
+// function), from which more instances of the same module can be created
+// without running that initialization again.
+// A snapshot contains the non-zero parts of all non-imported memories, the
+// values of all numeric globals, and the sizes of all data segments (to
+// preserve {data.drop}). Tables, reference-typed globals, and imported objects
+// are not part of the snapshot; instances created from a snapshot initialize
+// them from the module and their imports as usual. Imported immutable numeric
+// globals have to have the same values as when the snapshot was created, as
+// memory contents and globals may have been computed from them.
+class V8_EXPORT_PRIVATE WasmInstanceSnapshot {
+ public:
+  // Returns nullptr if the instance has state which cannot be captured:
+  // non-imported shared memories or globals, mutable reference-typed globals,
+  // active data segments for imported memories, or tables or element segments
+  // that may have changed since instantiation (exported tables, or code
+  // using instructions that modify tables or element segments). Modules with
+  // a start function are refused if they import functions, mutable globals,
+  // or memories, since the start function may have modified those (directly
+  // or through the imported functions), and it is not run again. Asm.js
+  // instances cannot be captured either.
+  static std::unique_ptr<WasmInstanceSnapshot> Create(
+      Isolate* isolate, DirectHandle<WasmInstanceObject> instance);
+
+  NativeModule* native_module() const { return native_module_.get(); }
+
+  // The number of memory bytes stored in this snapshot.
+  size_t stored_memory_bytes() const;
+
+ private:
+  friend class InstanceBuilder;
+
+  // Memories are stored in chunks of this size; chunks which are all zero
+  // are skipped.
+  static constexpr size_t kChunkSize = 4096;
+
+  struct MemoryContents {
+    size_t byte_length = 0;
+    std::vector<uint32_t> chunk_indices;
+    std::vector<uint8_t> chunks;
+  };
+
+  WasmInstanceSnapshot() = default;
+
+  std::shared_ptr<NativeModule> native_module_;
+  std::vector<MemoryContents> memories_;
+  std::vector<uint8_t> untagged_globals_;
+  std::vector<uint32_t> data_segment_sizes_;
+};
+
+// Instantiates {module_object} like {InstantiateToInstanceObject}, but
+// restores the state of {snapshot} instead of loading data segments and does
+// not run the start function. Fails with a link error if {imports} provide
+// immutable numeric globals with other values than when {snapshot} was
+// created.
+V8_EXPORT_PRIVATE MaybeHandle<WasmInstanceObject> InstantiateFromSnapshot(
+    Isolate* isolate, ErrorThrower* thrower,
+    Handle<WasmModuleObject> module_object, MaybeHandle<JSReceiver> imports,
+    const WasmInstanceSnapshot& snapshot);
+
 // Initializes a segment at index {segment_index} of the segment array of
 // {instance}. If successful, returns the empty {Optional}, otherwise an
 // {Optional} that contains the error message. Exits early if the segment is
@@ -4,7 +4,12 @@
 
 #include "src/wasm/pgo.h"
 
+#include <algorithm>
+#include <optional>
+
 #include "src/wasm/decoder.h"
+#include "src/wasm/function-body-decoder-impl.h"
+#include "src/wasm/function-body-decoder.h"
 #include "src/wasm/wasm-module-builder.h"  // For {ZoneBuffer}.
 
 namespace v8::internal::wasm {
@@ -15,14 +20,18 @@ constexpr uint8_t kFunctionTieredUpBit = 1 << 1;
 class ProfileGenerator {
  public:
   ProfileGenerator(const WasmModule* module,
+                   base::Vector<const uint8_t> wire_bytes,
                    const std::atomic<uint32_t>* tiering_budget_array)
       : module_(module),
+        wire_bytes_(wire_bytes),
         type_feedback_mutex_guard_(&module->type_feedback.mutex),
         tiering_budget_array_(tiering_budget_array) {}
 
   base::OwnedVector<uint8_t> GetProfileData() {
     ZoneBuffer buffer{&zone_};
 
+    // Profiles only apply to the module they were generated for.
+    buffer.write_u32(static_cast<uint32_t>(GetWireBytesHash(wire_bytes_)));
     SerializeTypeFeedback(buffer);
     SerializeTieringInfo(buffer);
 
@@ -96,66 +105,228 @@ class ProfileGenerator {
 
  private:
   const WasmModule* module_;
+  const base::Vector<const uint8_t> wire_bytes_;
   AccountingAllocator allocator_;
   Zone zone_{&allocator_, "wasm::ProfileGenerator"};
   base::SharedMutexGuard<base::kShared> type_feedback_mutex_guard_;
   const std::atomic<uint32_t>* const tiering_budget_array_;
 };
 
-void DeserializeTypeFeedback(Decoder& decoder, const WasmModule* module) {
-  base::SharedMutexGuard<base::kShared> type_feedback_guard{
-      &module->type_feedback.mutex};
-  std::unordered_map<uint32_t, FunctionTypeFeedback>& feedback_for_function =
-      module->type_feedback.feedback_for_function;
+// Decodes the type feedback part of the profile. Returns false if the data is
+// malformed or does not fit {module}; nothing is written to {module} here.
+bool DeserializeTypeFeedback(
+    Decoder& decoder, const WasmModule* module,
+    std::vector<std::pair<uint32_t, FunctionTypeFeedback>>* entries) {
+  const uint32_t num_functions =
+      static_cast<uint32_t>(module->functions.size());
   uint32_t num_entries = decoder.consume_u32v("num function entries");
-  CHECK_LE(num_entries, module->num_declared_functions);
+  if (num_entries > module->num_declared_functions) return false;
+  entries->reserve(num_entries);
   for (uint32_t missing_entries = num_entries; missing_entries > 0;
        --missing_entries) {
     FunctionTypeFeedback feedback;
     uint32_t function_index = decoder.consume_u32v("function index");
-    // Deserialize {feedback_vector}.
+    if (function_index < module->num_imported_functions ||
+        function_index >= num_functions) {
+      return false;
+    }
+    // Deserialize {feedback_vector}. Every entry takes at least one byte, which
+    // bounds the allocation for malformed data.
     uint32_t feedback_vector_size =
         decoder.consume_u32v("feedback vector size");
+    if (feedback_vector_size > decoder.available_bytes()) return false;
     feedback.feedback_vector.resize(feedback_vector_size);
     for (CallSiteFeedback& feedback : feedback.feedback_vector) {
       int num_cases = decoder.consume_i32v("num cases");
+      if (num_cases < 0 || num_cases > kMaxPolymorphism) return false;
       if (num_cases == 0) continue;  // no feedback
       if (num_cases == 1) {          // monomorphic
         int called_function_index = decoder.consume_i32v("function index");
         int call_count = decoder.consume_i32v("call count");
+        if (static_cast<uint32_t>(called_function_index) >= num_functions) {
+          return false;
+        }
         feedback = CallSiteFeedback{called_function_index, call_count};
       } else {  // polymorphic
         auto* polymorphic = new CallSiteFeedback::PolymorphicCase[num_cases];
+        // Hand over ownership first, so {polymorphic} is freed on failure.
+        feedback = CallSiteFeedback{polymorphic, num_cases};
         for (int i = 0; i < num_cases; ++i) {
           polymorphic[i].function_index =
               decoder.consume_i32v("function index");
           polymorphic[i].absolute_call_frequency =
               decoder.consume_i32v("call count");
+          if (static_cast<uint32_t>(polymorphic[i].function_index) >=
+              num_functions) {
+            return false;
+          }
         }
-        feedback = CallSiteFeedback{polymorphic, num_cases};
       }
     }
     // Deserialize {call_targets}.
     uint32_t num_call_targets = decoder.consume_u32v("num call targets");
+    if (num_call_targets > decoder.available_bytes()) return false;
     feedback.call_targets =
         base::OwnedVector<uint32_t>::NewForOverwrite(num_call_targets);
     for (uint32_t& call_target : feedback.call_targets) {
       call_target = decoder.consume_u32v("call target");
+      if (call_target >= num_functions &&
+          call_target != FunctionTypeFeedback::kCallIndirect &&
+          call_target != FunctionTypeFeedback::kCallRef) {
+        return false;
+      }
     }
+    if (!decoder.ok()) return false;
+    entries->emplace_back(function_index, std::move(feedback));
+  }
+  return true;
+}
+
+class CallTargetsInterface;
+
+class CallTargetsInterfaceBase {
+ public:
+  using ValidationTag = Decoder::FullValidationTag;
+  static constexpr DecodingMode decoding_mode = kFunctionBody;
+  static constexpr bool kUsesPoppedArgs = false;
+  using Value = ValueBase<ValidationTag>;
+  using Control = ControlBase<Value, ValidationTag>;
+  using FullDecoder = WasmFullDecoder<ValidationTag, CallTargetsInterface>;
+
+#define DEFINE_EMPTY_CALLBACK(name, ...) \
+  void name(FullDecoder* decoder, ##__VA_ARGS__) {}
+  INTERFACE_FUNCTIONS(DEFINE_EMPTY_CALLBACK)
+#undef DEFINE_EMPTY_CALLBACK
+};
 
-    // Finally, insert the new feedback into the map. Overwrite existing
-    // feedback, but check for consistency.
+// Collects the call targets of a function body the way Liftoff records them.
+// The decoder only calls the interface for reachable instructions, so calls in
+// unreachable code don't get an entry, just like they don't get a feedback
+// slot in Liftoff.
+class CallTargetsInterface : public CallTargetsInterfaceBase {
+ public:
+  void CallDirect(FullDecoder* decoder, const CallFunctionImmediate& imm,
+                  const Value args[], Value returns[]) {
+    call_targets_.push_back(imm.index);
+  }
+
+  void ReturnCall(FullDecoder* decoder, const CallFunctionImmediate& imm,
+                  const Value args[]) {
+    call_targets_.push_back(imm.index);
+  }
+
+  void CallIndirect(FullDecoder* decoder, const Value& index,
+                    const CallIndirectImmediate& imm, const Value args[],
+                    Value returns[]) {
+    AddCallIndirect();
+  }
+
+  void ReturnCallIndirect(FullDecoder* decoder, const Value& index,
+                          const CallIndirectImmediate& imm,
+                          const Value args[]) {
+    AddCallIndirect();
+  }
+
+  void CallRef(FullDecoder* decoder, const Value& func_ref,
+               const FunctionSig* sig, const Value args[],
+               const Value returns[]) {
+    call_targets_.push_back(FunctionTypeFeedback::kCallRef);
+  }
+
+  void ReturnCallRef(FullDecoder* decoder, const Value& func_ref,
+                     const FunctionSig* sig, const Value args[]) {
+    call_targets_.push_back(FunctionTypeFeedback::kCallRef);
+  }
+
+  std::vector<uint32_t>& call_targets() { return call_targets_; }
+
+ private:
+  void AddCallIndirect() {
+    if (v8_flags.wasm_inlining_call_indirect) {
+      call_targets_.push_back(FunctionTypeFeedback::kCallIndirect);
+    }
+  }
+
+  std::vector<uint32_t> call_targets_;
+};
+
+// Returns the call targets Liftoff records for the given function, or nothing
+// if the function body is invalid.
+std::optional<std::vector<uint32_t>> CallTargetsFromBody(
+    const WasmModule* module, base::Vector<const uint8_t> wire_bytes,
+    WasmEnabledFeatures enabled_features, uint32_t func_index, Zone* zone) {
+  const WasmFunction& func = module->functions[func_index];
+  if (func.code.end_offset() > wire_bytes.size()) return {};
+  bool is_shared = module->types[func.sig_index].is_shared;
+  FunctionBody body{func.sig, func.code.offset(),
+                    wire_bytes.begin() + func.code.offset(),
+                    wire_bytes.begin() + func.code.end_offset(), is_shared};
+  WasmDetectedFeatures detected_features;
+  WasmFullDecoder<Decoder::FullValidationTag, CallTargetsInterface> decoder(
+      zone, module, enabled_features, &detected_features, body);
+  decoder.Decode();
+  if (decoder.failed()) return {};
+  module->set_function_validated(func_index);
+  return std::move(decoder.interface().call_targets());
+}
+
+// Checks the decoded type feedback against the function bodies. Liftoff keeps
+// installed call targets, and TurboFan indexes the feedback vector by call
+// site, so both have to have exactly one entry per call instruction.
+bool MatchesFunctionBodies(
+    const WasmModule* module, base::Vector<const uint8_t> wire_bytes,
+    WasmEnabledFeatures enabled_features,
+    const std::vector<std::pair<uint32_t, FunctionTypeFeedback>>& entries) {
+  AccountingAllocator allocator;
+  for (const auto& [function_index, feedback] : entries) {
+    if (feedback.feedback_vector.size() != feedback.call_targets.size()) {
+      return false;
+    }
+    Zone zone{&allocator, ZONE_NAME};
+    std::optional<std::vector<uint32_t>> call_targets = CallTargetsFromBody(
+        module, wire_bytes, enabled_features, function_index, &zone);
+    if (!call_targets.has_value() ||
+        !std::equal(call_targets->begin(), call_targets->end(),
+                    feedback.call_targets.begin(),
+                    feedback.call_targets.end())) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Installs the decoded type feedback in {module}. Existing feedback is
+// overwritten, but must be consistent with the new one; otherwise nothing is
+// installed and false is returned.
+bool InstallTypeFeedback(
+    const WasmModule* module,
+    std::vector<std::pair<uint32_t, FunctionTypeFeedback>> entries) {
+  base::SharedMutexGuard<base::kExclusive> type_feedback_guard{
+      &module->type_feedback.mutex};
+  std::unordered_map<uint32_t, FunctionTypeFeedback>& feedback_for_function =
+      module->type_feedback.feedback_for_function;
+  for (const auto& [function_index, feedback] : entries) {
+    auto feedback_it = feedback_for_function.find(function_index);
+    if (feedback_it == feedback_for_function.end()) continue;
+    const FunctionTypeFeedback& old_feedback = feedback_it->second;
+    if (!old_feedback.feedback_vector.empty() &&
+        old_feedback.feedback_vector.size() !=
+            feedback.feedback_vector.size()) {
+      return false;
+    }
+    if (old_feedback.call_targets.as_vector() !=
+        feedback.call_targets.as_vector()) {
+      return false;
+    }
+  }
+  for (auto& [function_index, feedback] : entries) {
     auto [feedback_it, is_new] =
         feedback_for_function.emplace(function_index, std::move(feedback));
     if (!is_new) {
-      FunctionTypeFeedback& old_feedback = feedback_it->second;
-      CHECK(old_feedback.feedback_vector.empty() ||
-            old_feedback.feedback_vector.size() == feedback_vector_size);
-      CHECK_EQ(old_feedback.call_targets.as_vector(),
-               feedback.call_targets.as_vector());
-      std::swap(old_feedback.feedback_vector, feedback.feedback_vector);
+      std::swap(feedback_it->second.feedback_vector, feedback.feedback_vector);
     }
   }
+  return true;
 }
 
 std::unique_ptr<ProfileInformation> DeserializeTieringInformation(
@@ -166,7 +337,7 @@ std::unique_ptr<ProfileInformation> DeserializeTieringInformation(
   uint32_t end = start + module->num_declared_functions;
   for (uint32_t func_index = start; func_index < end; ++func_index) {
     uint8_t tiering_info = decoder.consume_u8("tiering info");
-    CHECK_EQ(0, tiering_info & ~3);
+    if (tiering_info & ~3) return {};
     bool was_executed = tiering_info & kFunctionExecutedBit;
     bool was_tiered_up = tiering_info & kFunctionTieredUpBit;
     if (was_tiered_up) tiered_up_functions.push_back(func_index);
@@ -177,16 +348,42 @@ std::unique_ptr<ProfileInformation> DeserializeTieringInformation(
                                               std::move(tiered_up_functions));
 }
 
+base::OwnedVector<uint8_t> GetProfileData(
+    const WasmModule* module, base::Vector<const uint8_t> wire_bytes,
+    std::atomic<uint32_t>* tiering_budget_array) {
+  ProfileGenerator profile_generator{module, wire_bytes, tiering_budget_array};
+  return profile_generator.GetProfileData();
+}
+
 std::unique_ptr<ProfileInformation> RestoreProfileData(
-    const WasmModule* module, base::Vector<uint8_t> profile_data) {
+    const WasmModule* module, base::Vector<const uint8_t> wire_bytes,
+    WasmEnabledFeatures enabled_features,
+    base::Vector<const uint8_t> profile_data) {
+  if (module->origin != kWasmOrigin) return {};
   Decoder decoder{profile_data.begin(), profile_data.end()};
 
-  DeserializeTypeFeedback(decoder, module);
+  uint32_t wire_bytes_hash = decoder.consume_u32("wire bytes hash", nullptr);
+  if (!decoder.ok() ||
+      wire_bytes_hash != static_cast<uint32_t>(GetWireBytesHash(wire_bytes))) {
+    return {};
+  }
+  std::vector<std::pair<uint32_t, FunctionTypeFeedback>> type_feedback;
+  if (!DeserializeTypeFeedback(decoder, module, &type_feedback)) return {};
   std::unique_ptr<ProfileInformation> pgo_info =
       DeserializeTieringInformation(decoder, module);
 
-  CHECK(decoder.ok());
-  CHECK_EQ(decoder.pc(), decoder.end());
+  if (!pgo_info || !decoder.ok() || decoder.pc() != decoder.end()) return {};
+  // The hash is no protection against crafted profiles, so the feedback is
+  // checked against the function bodies as well.
+  if (!MatchesFunctionBodies(module, wire_bytes, enabled_features,
+                             type_feedback)) {
+    return {};
+  }
+  // Liftoff doesn't collect feedback without inlining, so there is nothing to
+  // install the feedback for.
+  if (enabled_features.has_inlining() || module->is_wasm_gc) {
+    if (!InstallTypeFeedback(module, std::move(type_feedback))) return {};
+  }
 
   return pgo_info;
 }
@@ -202,8 +399,8 @@ void DumpProfileToFile(const WasmModule* module,
   base::EmbeddedVector<char, 32> filename;
   SNPrintF(filename, "profile-wasm-%08x", hash);
 
-  ProfileGenerator profile_generator{module, tiering_budget_array};
-  base::OwnedVector<uint8_t> profile_data = profile_generator.GetProfileData();
+  base::OwnedVector<uint8_t> profile_data =
+      GetProfileData(module, wire_bytes, tiering_budget_array);
 
   PrintF(
       "Dumping Wasm PGO data to file '%s' (module size %zu, %u declared "
@@ -218,7 +415,8 @@ void DumpProfileToFile(const WasmModule* module,
 }
 
 std::unique_ptr<ProfileInformation> LoadProfileFromFile(
-    const WasmModule* module, base::Vector<const uint8_t> wire_bytes) {
+    const WasmModule* module, base::Vector<const uint8_t> wire_bytes,
+    WasmEnabledFeatures enabled_features) {
   CHECK(!wire_bytes.empty());
   // File are named `profile-wasm-<hash>`.
   // We use the same hash as for reported scripts, to make it easier to
@@ -248,7 +446,13 @@ std::unique_ptr<ProfileInformation> LoadProfileFromFile(
 
   base::Fclose(file);
 
-  return RestoreProfileData(module, profile_data.as_vector());
+  std::unique_ptr<ProfileInformation> pgo_info =
+      RestoreProfileData(module, wire_bytes, enabled_features,
+                         profile_data.as_vector());
+  if (!pgo_info) {
+    PrintF("Invalid Wasm PGO data in file '%s'\n", filename.begin());
+  }
+  return pgo_info;
 }
 
 }  // namespace v8::internal::wasm
@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "src/base/vector.h"
+#include "src/wasm/wasm-features.h"
 
 namespace v8::internal::wasm {
 
@@ -40,12 +41,29 @@ class ProfileInformation {
   const std::vector<uint32_t> tiered_up_functions_;
 };
 
+// Serializes the profile of {module}: the hash of its wire bytes, type
+// feedback, and which functions were executed and tiered up.
+base::OwnedVector<uint8_t> GetProfileData(
+    const WasmModule* module, base::Vector<const uint8_t> wire_bytes,
+    std::atomic<uint32_t>* tiering_budget_array);
+
+// Installs the type feedback from {profile_data} in {module} and returns the
+// tiering information. Returns nullptr if {profile_data} is invalid or does not
+// match {module}, i.e. was generated for other wire bytes or has feedback that
+// doesn't fit the call instructions of a function; the module is left
+// unchanged in that case.
+V8_WARN_UNUSED_RESULT std::unique_ptr<ProfileInformation> RestoreProfileData(
+    const WasmModule* module, base::Vector<const uint8_t> wire_bytes,
+    WasmEnabledFeatures enabled_features,
+    base::Vector<const uint8_t> profile_data);
+
 void DumpProfileToFile(const WasmModule* module,
                        base::Vector<const uint8_t> wire_bytes,
                        std::atomic<uint32_t>* tiering_budget_array);
 
 V8_WARN_UNUSED_RESULT std::unique_ptr<ProfileInformation> LoadProfileFromFile(
-    const WasmModule* module, base::Vector<const uint8_t> wire_bytes);
+    const WasmModule* module, base::Vector<const uint8_t> wire_bytes,
+    WasmEnabledFeatures enabled_features);
 
 }  // namespace v8::internal::wasm
 
@@ -31,7 +31,11 @@ StackMemory::~StackMemory() {
 StackMemory::StackMemory() : owned_(true) {
   static std::atomic<int> next_id(1);
   id_ = next_id.fetch_add(1);
-  size_t kJsStackSizeKB = v8_flags.wasm_stack_switching_stack_size;
+  // Growable stacks start with a small segment and only grow on demand, which
+  // keeps the memory of many suspended computations small.
+  size_t kJsStackSizeKB = v8_flags.experimental_wasm_growable_stacks
+                              ? v8_flags.wasm_growable_stack_initial_size
+                              : v8_flags.wasm_stack_switching_stack_size;
   first_segment_ = new StackSegment((kJsStackSizeKB + kJSLimitOffsetKB) * KB);
   active_segment_ = first_segment_;
   size_ = first_segment_->size_;
@@ -58,8 +62,8 @@ StackMemory::StackSegment::StackSegment(size_t size) {
 
 StackMemory::StackSegment::~StackSegment() {
   PageAllocator* allocator = GetPlatformPageAllocator();
-  if (!allocator->DecommitPages(limit_, size_)) {
-    V8::FatalProcessOutOfMemory(nullptr, "Decommit stack memory");
+  if (!allocator->FreePages(limit_, size_)) {
+    V8::FatalProcessOutOfMemory(nullptr, "Free stack memory");
   }
 }
 
@@ -115,28 +119,64 @@ void StackMemory::Reset() {
   size_ = active_segment_->size_;
 }
 
+void StackMemory::FreeGrownSegments() {
+  DCHECK(owned_);
+  DCHECK_EQ(active_segment_, first_segment_);
+  StackSegment* segment = first_segment_->next_segment_;
+  first_segment_->next_segment_ = nullptr;
+  while (segment) {
+    StackSegment* next_segment = segment->next_segment_;
+    delete segment;
+    segment = next_segment;
+  }
+}
+
 std::unique_ptr<StackMemory> StackPool::GetOrAllocate() {
   std::unique_ptr<StackMemory> stack;
   if (freelist_.empty()) {
     stack = StackMemory::New();
+    ++stats_.allocated_stacks;
   } else {
     stack = std::move(freelist_.back());
     freelist_.pop_back();
-    size_ -= stack->size_;
+    size_ -= stack->allocated_size();
+    ++stats_.reused_stacks;
   }
   return stack;
 }
 
 void StackPool::Add(std::unique_ptr<StackMemory> stack) {
-  if (size_ + stack->size_ > kMaxSize) {
+  stack->Reset();
+  const size_t max_size = size_t{v8_flags.wasm_stack_pool_size} * KB;
+  size_t stack_size = stack->allocated_size();
+  if (size_ + stack_size > max_size &&
+      stack->first_segment_->next_segment_ != nullptr) {
+    for (auto segment = stack->first_segment_->next_segment_; segment;
+         segment = segment->next_segment_) {
+      ++stats_.freed_segments;
+    }
+    stack->FreeGrownSegments();
+    stack_size = stack->allocated_size();
+  }
+  if (size_ + stack_size > max_size) {
+    ++stats_.freed_stacks;
     return;
   }
-  size_ += stack->allocated_size();
-  stack->Reset();
+  size_ += stack_size;
   freelist_.push_back(std::move(stack));
 }
 
-void StackPool::ReleaseFinishedStacks() { freelist_.clear(); }
+void StackPool::ReleaseFinishedStacks() {
+  if (v8_flags.trace_wasm_stack_switching) {
+    PrintF(
+        "Release %zu finished stacks (%zu bytes; allocated: %zu, reused: %zu, "
+        "freed segments: %zu, freed stacks: %zu)\n",
+        freelist_.size(), size_, stats_.allocated_stacks, stats_.reused_stacks,
+        stats_.freed_segments, stats_.freed_stacks);
+  }
+  freelist_.clear();
+  size_ = 0;
+}
 
 size_t StackPool::Size() const {
   return freelist_.size() * sizeof(decltype(freelist_)::value_type) + size_;
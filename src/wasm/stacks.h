@@ -95,6 +95,8 @@ class StackMemory {
   bool Grow(Address current_fp);
   Address Shrink();
   void Reset();
+  // Frees all segments except the first one. The stack must not be in use.
+  void FreeGrownSegments();
 
   class StackSegment {
    public:
@@ -163,8 +165,23 @@ class StackMemory {
 
 // A pool of "finished" stacks, i.e. stacks whose last frame have returned and
 // whose memory can be reused for new suspendable computations.
+// Pooled stacks keep their grown segments, so that a computation that needed a
+// deep stack before can reuse them, unless the pool would exceed
+// --wasm-stack-pool-size. In that case the grown segments are freed first, and
+// only if the first segment does not fit either, the whole stack is freed.
 class StackPool {
  public:
+  struct Stats {
+    // Stacks that were newly allocated by {GetOrAllocate}.
+    size_t allocated_stacks = 0;
+    // Stacks that were taken from the free list by {GetOrAllocate}.
+    size_t reused_stacks = 0;
+    // Grown segments that were freed to make room in the pool.
+    size_t freed_segments = 0;
+    // Finished stacks that were freed because the pool was full.
+    size_t freed_stacks = 0;
+  };
+
   // Gets a stack from the free list if one exists, else allocates it.
   std::unique_ptr<StackMemory> GetOrAllocate();
   // Adds a finished stack to the free list.
@@ -172,13 +189,14 @@ class StackPool {
   // Decommit the stack memories and empty the freelist.
   void ReleaseFinishedStacks();
   size_t Size() const;
+  size_t pooled_stacks() const { return freelist_.size(); }
+  const Stats& stats() const { return stats_; }
 
  private:
   std::vector<std::unique_ptr<StackMemory>> freelist_;
+  // The total allocated size of the stacks in the free list.
   size_t size_ = 0;
-  // If the next finished stack would move the total size above this limit, the
-  // stack is freed instead of being added to the free list.
-  static constexpr int kMaxSize = 4 * MB;
+  Stats stats_;
 };
 
 }  // namespace v8::internal::wasm
@@ -44,6 +44,8 @@ class V8_EXPORT_PRIVATE AsyncStreamingDecoder : public StreamingDecoder {
   void NotifyNativeModuleCreated(
       const std::shared_ptr<NativeModule>& native_module) override;
 
+  StreamingProgress GetProgress() override;
+
  private:
   // The SectionBuffer is the data object for the content of a single section.
   // It stores all bytes of the section (including section id and section
@@ -186,13 +188,19 @@ class V8_EXPORT_PRIVATE AsyncStreamingDecoder : public StreamingDecoder {
             num_functions, module_offset() - 1, std::move(wire_bytes_storage),
             code_section_start, code_section_length)) {
       Fail();
+      return;
     }
+    progress_.total_functions = num_functions;
   }
 
   void ProcessFunctionBody(base::Vector<const uint8_t> bytes,
                            uint32_t module_offset) {
     if (!ok()) return;
-    if (!processor_->ProcessFunctionBody(bytes, module_offset)) Fail();
+    if (!processor_->ProcessFunctionBody(bytes, module_offset)) {
+      Fail();
+      return;
+    }
+    ++progress_.received_functions;
   }
 
   void Fail() {
@@ -221,6 +229,9 @@ class V8_EXPORT_PRIVATE AsyncStreamingDecoder : public StreamingDecoder {
   std::vector<std::shared_ptr<SectionBuffer>> section_buffers_;
   bool code_section_processed_ = false;
   uint32_t module_offset_ = 0;
+  // Progress as reported by {GetProgress}; {received_bytes} is computed on
+  // demand.
+  StreamingProgress progress_;
 
   // Store the full wire bytes in a vector of vectors to avoid having to grow
   // large vectors (measured up to 100ms delay in 2023-03).
@@ -336,6 +347,16 @@ void AsyncStreamingDecoder::Finish(bool can_use_compiled_module) {
   processor->OnFinishedStream(std::move(bytes_copy), failed);
 }
 
+StreamingProgress AsyncStreamingDecoder::GetProgress() {
+  // After {Finish} or {Abort} the processor is gone; report the last known
+  // compilation progress then.
+  if (processor_) {
+    progress_.compiled_functions = processor_->NumCompiledFunctions();
+  }
+  progress_.received_bytes = module_offset_;
+  return progress_;
+}
+
 void AsyncStreamingDecoder::Abort() {
   TRACE_STREAMING("Abort\n");
   // Ignore {Abort} after {Finish}.
@@ -22,6 +22,14 @@ namespace v8::internal::wasm {
 
 class NativeModule;
 
+// Progress of a streaming compilation, see {StreamingDecoder::GetProgress}.
+struct StreamingProgress {
+  size_t received_bytes = 0;
+  int total_functions = 0;
+  int received_functions = 0;
+  int compiled_functions = 0;
+};
+
 // This class is an interface for the StreamingDecoder to start the processing
 // of the incoming module bytes.
 class V8_EXPORT_PRIVATE StreamingProcessor {
@@ -51,6 +59,8 @@ class V8_EXPORT_PRIVATE StreamingProcessor {
 
   // Report the end of a chunk.
   virtual void OnFinishedChunk() = 0;
+  // Returns the number of functions for which baseline compilation finished.
+  virtual int NumCompiledFunctions() const { return 0; }
   // Report the end of the stream. This will be called even after an error has
   // been detected. In any case, the parameter is the total received bytes.
   virtual void OnFinishedStream(base::OwnedVector<const uint8_t> bytes,
@@ -101,6 +111,10 @@ class V8_EXPORT_PRIVATE StreamingDecoder {
   virtual void NotifyNativeModuleCreated(
       const std::shared_ptr<NativeModule>& native_module) = 0;
 
+  // Returns how far decoding and compilation of the module got. Compilation
+  // progress is only updated until {Finish} or {Abort} is called.
+  virtual StreamingProgress GetProgress() = 0;
+
   const std::string& url() const { return *url_; }
   std::shared_ptr<const std::string> shared_url() const { return url_; }
 
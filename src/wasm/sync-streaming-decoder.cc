@@ -79,6 +79,13 @@ class V8_EXPORT_PRIVATE SyncStreamingDecoder : public StreamingDecoder {
     buffer_.clear();
   }
 
+  StreamingProgress GetProgress() override {
+    // Nothing is decoded before {Finish}.
+    StreamingProgress progress;
+    progress.received_bytes = buffer_size_;
+    return progress;
+  }
+
   void NotifyCompilationDiscarded() override { buffer_.clear(); }
 
   void NotifyNativeModuleCreated(
@@ -37,6 +37,7 @@
 #include "src/wasm/wasm-debug.h"
 #include "src/wasm/wasm-limits.h"
 #include "src/wasm/wasm-objects-inl.h"
+#include "src/wasm/wasm-serialization.h"
 
 #if V8_ENABLE_DRUMBRAKE
 #include "src/wasm/interpreter/wasm-interpreter-inl.h"
@@ -655,6 +656,15 @@ MaybeHandle<WasmModuleObject> WasmEngine::SyncCompile(
     ModuleWireBytes bytes) {
   int compilation_id = next_compilation_id_.fetch_add(1);
   TRACE_EVENT1("v8.wasm", "wasm.SyncCompile", "id", compilation_id);
+  // If experimental code caching via a directory is enabled, try to load the
+  // module from there first.
+  if (V8_UNLIKELY(v8_flags.experimental_wasm_code_cache_dir)) {
+    Handle<WasmModuleObject> module_object;
+    if (ReadFromCodeCacheDir(isolate, bytes.module_bytes(), compile_imports)
+            .ToHandle(&module_object)) {
+      return module_object;
+    }
+  }
   v8::metrics::Recorder::ContextId context_id =
       isolate->GetOrRegisterRecorderContextId(isolate->native_context());
   std::shared_ptr<WasmModule> module;
@@ -681,7 +691,8 @@ MaybeHandle<WasmModuleObject> WasmEngine::SyncCompile(
   // If experimental PGO via files is enabled, load profile information now.
   std::unique_ptr<ProfileInformation> pgo_info;
   if (V8_UNLIKELY(v8_flags.experimental_wasm_pgo_from_file)) {
-    pgo_info = LoadProfileFromFile(module.get(), bytes.module_bytes());
+    pgo_info =
+        LoadProfileFromFile(module.get(), bytes.module_bytes(), enabled);
   }
 
   // Transfer ownership of the WasmModule to the {Managed<WasmModule>} generated
@@ -691,6 +702,10 @@ MaybeHandle<WasmModuleObject> WasmEngine::SyncCompile(
       bytes, compilation_id, context_id, pgo_info.get());
   if (!native_module) return {};
 
+  if (V8_UNLIKELY(v8_flags.experimental_wasm_code_cache_dir)) {
+    WriteToCodeCacheDirAfterCompilation(native_module);
+  }
+
 #ifdef DEBUG
   // Ensure that code GC will check this isolate for live code.
   {
@@ -830,6 +845,17 @@ void WasmEngine::AsyncCompile(
   base::OwnedVector<const uint8_t> copy =
       base::OwnedVector<const uint8_t>::Of(bytes.module_bytes());
 
+  // As in {SyncCompile}, a hit in the code cache directory skips compilation.
+  if (V8_UNLIKELY(v8_flags.experimental_wasm_code_cache_dir)) {
+    HandleScope scope(isolate);
+    Handle<WasmModuleObject> module_object;
+    if (ReadFromCodeCacheDir(isolate, copy.as_vector(), compile_imports)
+            .ToHandle(&module_object)) {
+      resolver->OnCompilationSucceeded(module_object);
+      return;
+    }
+  }
+
   AsyncCompileJob* job = CreateAsyncCompileJob(
       isolate, enabled, std::move(compile_imports), std::move(copy),
       isolate->native_context(), api_method_name_for_errors,
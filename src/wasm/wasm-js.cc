@@ -106,6 +106,10 @@ class WasmStreaming::WasmStreamingImpl {
 
   void SetUrl(base::Vector<const char> url) { streaming_decoder_->SetUrl(url); }
 
+  i::wasm::StreamingProgress GetProgress() {
+    return streaming_decoder_->GetProgress();
+  }
+
  private:
   i::Isolate* const i_isolate_;
   const WasmEnabledFeatures enabled_features_;
@@ -153,6 +157,16 @@ void WasmStreaming::SetUrl(const char* url, size_t length) {
   impl_->SetUrl(base::VectorOf(url, length));
 }
 
+WasmStreaming::Progress WasmStreaming::GetProgress() {
+  i::wasm::StreamingProgress progress = impl_->GetProgress();
+  Progress result;
+  result.received_bytes = progress.received_bytes;
+  result.total_functions = progress.total_functions;
+  result.received_functions = progress.received_functions;
+  result.compiled_functions = progress.compiled_functions;
+  return result;
+}
+
 // static
 std::shared_ptr<WasmStreaming> WasmStreaming::Unpack(Isolate* isolate,
                                                      Local<Value> value) {
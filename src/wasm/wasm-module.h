@@ -620,8 +620,7 @@ struct TypeFeedbackStorage {
   // - WasmGraphBuilder: reads {feedback_vector}.
   // - Feedback vector allocation: reads {call_targets.size()}.
   // - PGO ProfileGenerator: reads everything.
-  // - PGO deserializer: writes everything, currently not locked, relies on
-  //   being called before multi-threading enters the picture.
+  // - PGO deserializer: writes everything.
   // - Deoptimizer: sets needs_reprocessing_after_deopt.
   mutable base::SharedMutex mutex;
 
@@ -4,9 +4,16 @@
 
 #include "src/wasm/wasm-serialization.h"
 
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include "src/base/platform/platform.h"
 #include "src/codegen/assembler-arch.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/debug/debug.h"
+#include "src/init/v8.h"
 #include "src/runtime/runtime.h"
 #include "src/snapshot/snapshot-data.h"
 #include "src/utils/ostreams.h"
@@ -669,6 +676,7 @@ class V8_EXPORT_PRIVATE NativeModuleDeserializer {
   DeserializationUnit ReadCode(int fn_index, Reader* reader);
   void ReadTieringBudget(Reader* reader);
   void CopyAndRelocate(const DeserializationUnit& unit);
+  void FlushBatch(const std::vector<DeserializationUnit>& batch);
   void Publish(std::vector<DeserializationUnit> batch);
 
   NativeModule* const native_module_;
@@ -703,6 +711,7 @@ class DeserializeCodeTask : public JobTask {
       for (const auto& unit : batch) {
         deserializer_->CopyAndRelocate(unit);
       }
+      deserializer_->FlushBatch(batch);
       publish_queue_.Add(std::move(batch));
       delegate->NotifyConcurrencyIncrease();
     }
@@ -967,10 +976,25 @@ void NativeModuleDeserializer::CopyAndRelocate(
         UNREACHABLE();
     }
   }
+}
 
-  // Finally, flush the icache for that code.
-  FlushInstructionCache(unit.code->instructions().begin(),
-                        unit.code->instructions().size());
+void NativeModuleDeserializer::FlushBatch(
+    const std::vector<DeserializationUnit>& batch) {
+  // Code of consecutive units is allocated back to back in the code space
+  // (see {ReadCode}), so flush contiguous runs with a single call instead of
+  // flushing each function separately.
+  DCHECK(!batch.empty());
+  base::Vector<uint8_t> run = batch.front().code->instructions();
+  for (size_t i = 1; i < batch.size(); ++i) {
+    base::Vector<uint8_t> instructions = batch[i].code->instructions();
+    if (instructions.begin() == run.end()) {
+      run = base::VectorOf(run.begin(), run.size() + instructions.size());
+      continue;
+    }
+    FlushInstructionCache(run.begin(), run.size());
+    run = instructions;
+  }
+  FlushInstructionCache(run.begin(), run.size());
 }
 
 void NativeModuleDeserializer::ReadTieringBudget(Reader* reader) {
@@ -1080,6 +1104,176 @@ MaybeHandle<WasmModuleObject> DeserializeNativeModule(
   return module_object;
 }
 
+std::string GetCodeCacheDirEntryPath(base::Vector<const uint8_t> wire_bytes) {
+  DCHECK_NOT_NULL(v8_flags.experimental_wasm_code_cache_dir);
+  std::string path = v8_flags.experimental_wasm_code_cache_dir;
+  if (path.size() && !base::OS::isDirectorySeparator(path[path.size() - 1])) {
+    path += base::OS::DirectorySeparator();
+  }
+  // Entries are named `wasm-code-<slot>`. Modules hashing to the same slot
+  // replace each other, which bounds the number of files in the directory.
+  uint32_t slots =
+      std::max(1u, v8_flags.experimental_wasm_code_cache_dir_slots.value());
+  uint32_t slot = static_cast<uint32_t>(GetWireBytesHash(wire_bytes)) % slots;
+  base::EmbeddedVector<char, 32> filename;
+  SNPrintF(filename, "wasm-code-%u", slot);
+  path += filename.begin();
+  return path;
+}
+
+bool WriteToCodeCacheDir(NativeModule* native_module) {
+  base::Vector<const uint8_t> wire_bytes = native_module->wire_bytes();
+  WasmSerializer serializer(native_module);
+  size_t serialized_size = serializer.GetSerializedNativeModuleSize();
+  // An entry holds the wire bytes followed by the serialized module, so that a
+  // hash collision can never hand out code compiled for a different module.
+  size_t entry_size = sizeof(uint64_t) + wire_bytes.size() + serialized_size;
+  base::OwnedVector<uint8_t> entry =
+      base::OwnedVector<uint8_t>::NewForOverwrite(entry_size);
+  Writer writer(entry.as_vector());
+  writer.Write(static_cast<uint64_t>(wire_bytes.size()));
+  writer.WriteVector(wire_bytes);
+  if (!serializer.SerializeNativeModule(writer.current_buffer())) return false;
+
+  // Write to a temporary file first and move it into place, so that concurrent
+  // readers in other processes only ever see complete entries. The name is
+  // unique per write, as writers in this process (for different modules
+  // mapping to the same slot) can race with each other.
+  static std::atomic<uint32_t> next_temp_file_id{0};
+  std::string path = GetCodeCacheDirEntryPath(wire_bytes);
+  std::string temp_path =
+      path + ".tmp." + std::to_string(base::OS::GetCurrentProcessId()) + "." +
+      std::to_string(
+          next_temp_file_id.fetch_add(1, std::memory_order_relaxed));
+  FILE* file = base::OS::FOpen(temp_path.c_str(), "wb");
+  if (!file) return false;
+  size_t written = fwrite(entry.begin(), 1, entry.size(), file);
+  base::Fclose(file);
+  if (written != entry.size() ||
+      std::rename(temp_path.c_str(), path.c_str()) != 0) {
+    base::OS::Remove(temp_path.c_str());
+    return false;
+  }
+  if (v8_flags.trace_wasm_serialization) {
+    PrintF("Wrote %zu bytes to Wasm code cache entry '%s'\n", entry.size(),
+           path.c_str());
+  }
+  return true;
+}
+
+MaybeHandle<WasmModuleObject> ReadFromCodeCacheDir(
+    Isolate* isolate, base::Vector<const uint8_t> wire_bytes,
+    const CompileTimeImports& compile_imports) {
+  std::string path = GetCodeCacheDirEntryPath(wire_bytes);
+  // Map the entry instead of reading it, so that all processes using the cache
+  // share the same page cache pages for it.
+  std::unique_ptr<base::OS::MemoryMappedFile> file{
+      base::OS::MemoryMappedFile::open(
+          path.c_str(), base::OS::MemoryMappedFile::FileMode::kReadOnly)};
+  if (!file) return {};
+  Reader reader(base::VectorOf(static_cast<const uint8_t*>(file->memory()),
+                               file->size()));
+  if (reader.current_size() < sizeof(uint64_t)) return {};
+  uint64_t wire_bytes_size = reader.Read<uint64_t>();
+  if (wire_bytes_size != wire_bytes.size() ||
+      reader.current_size() < wire_bytes_size) {
+    return {};
+  }
+  base::Vector<const uint8_t> cached_wire_bytes =
+      reader.ReadVector<uint8_t>(wire_bytes.size());
+  if (cached_wire_bytes != wire_bytes) return {};
+  if (v8_flags.trace_wasm_serialization) {
+    PrintF("Found Wasm code cache entry '%s'\n", path.c_str());
+  }
+  return DeserializeNativeModule(isolate, reader.current_buffer(), wire_bytes,
+                                 compile_imports, {});
+}
+
+namespace {
+
+// Writes a module to the code cache directory whenever it has accumulated more
+// top-tier code (or, without dynamic tiering, once baseline compilation is
+// done). The file is written by a background task, to keep serialization out
+// of the compilation callbacks. At most one task per module is in flight;
+// events arriving while it runs are coalesced into a single rewrite.
+class WriteToCodeCacheDirCallback : public CompilationEventCallback {
+ public:
+  explicit WriteToCodeCacheDirCallback(
+      std::weak_ptr<NativeModule> native_module)
+      : state_(std::make_shared<State>(std::move(native_module))) {}
+
+  void call(CompilationEvent event) override {
+    bool write = v8_flags.wasm_dynamic_tiering
+                     ? event == CompilationEvent::kFinishedCompilationChunk
+                     : event == CompilationEvent::kFinishedBaselineCompilation;
+    if (!write) return;
+    {
+      base::MutexGuard guard(&state_->mutex);
+      state_->write_requested = true;
+      if (state_->task_running) return;
+      state_->task_running = true;
+    }
+    V8::GetCurrentPlatform()->CallOnWorkerThread(
+        std::make_unique<WriteTask>(state_));
+  }
+
+  ReleaseAfterFinalEvent release_after_final_event() override {
+    return kKeepAfterFinalEvent;
+  }
+
+ private:
+  // Shared with the write task, which can outlive the callback.
+  struct State {
+    explicit State(std::weak_ptr<NativeModule> native_module)
+        : native_module(std::move(native_module)) {}
+
+    const std::weak_ptr<NativeModule> native_module;
+    base::Mutex mutex;
+    bool write_requested = false;  // Protected by {mutex}.
+    bool task_running = false;     // Protected by {mutex}.
+  };
+
+  class WriteTask : public v8::Task {
+   public:
+    explicit WriteTask(std::shared_ptr<State> state)
+        : state_(std::move(state)) {}
+
+    void Run() override {
+      while (true) {
+        {
+          base::MutexGuard guard(&state_->mutex);
+          if (!state_->write_requested) {
+            state_->task_running = false;
+            return;
+          }
+          state_->write_requested = false;
+        }
+        std::shared_ptr<NativeModule> native_module =
+            state_->native_module.lock();
+        if (!native_module) {
+          base::MutexGuard guard(&state_->mutex);
+          state_->task_running = false;
+          return;
+        }
+        WriteToCodeCacheDir(native_module.get());
+      }
+    }
+
+   private:
+    const std::shared_ptr<State> state_;
+  };
+
+  const std::shared_ptr<State> state_;
+};
+
+}  // namespace
+
+void WriteToCodeCacheDirAfterCompilation(
+    const std::shared_ptr<NativeModule>& native_module) {
+  native_module->compilation_state()->AddCallback(
+      std::make_unique<WriteToCodeCacheDirCallback>(native_module));
+}
+
 }  // namespace wasm
 }  // namespace internal
 }  // namespace v8
@@ -9,6 +9,9 @@
 #ifndef V8_WASM_WASM_SERIALIZATION_H_
 #define V8_WASM_WASM_SERIALIZATION_H_
 
+#include <memory>
+#include <string>
+
 #include "src/wasm/wasm-code-manager.h"
 #include "src/wasm/wasm-objects.h"
 
@@ -64,6 +67,24 @@ V8_EXPORT_PRIVATE MaybeHandle<WasmModuleObject> DeserializeNativeModule(
     const CompileTimeImports& compile_imports,
     base::Vector<const char> source_url);
 
+// Experimental cache of serialized modules in the directory given by
+// --experimental-wasm-code-cache-dir, which can be shared by all processes
+// using the same V8 version and flags.
+// Returns the path of the cache entry for the given wire bytes.
+V8_EXPORT_PRIVATE std::string GetCodeCacheDirEntryPath(
+    base::Vector<const uint8_t> wire_bytes);
+// Serializes {native_module} into its cache entry. Returns false if there is no
+// TurboFan code to serialize yet or the entry could not be written.
+V8_EXPORT_PRIVATE bool WriteToCodeCacheDir(NativeModule* native_module);
+// Deserializes a module from the cache entry for {wire_bytes}, if present.
+V8_EXPORT_PRIVATE MaybeHandle<WasmModuleObject> ReadFromCodeCacheDir(
+    Isolate* isolate, base::Vector<const uint8_t> wire_bytes,
+    const CompileTimeImports& compile_imports);
+// Keeps the cache entry of {native_module} up to date as compilation
+// progresses. Used by synchronous, asynchronous and streaming compilation.
+V8_EXPORT_PRIVATE void WriteToCodeCacheDirAfterCompilation(
+    const std::shared_ptr<NativeModule>& native_module);
+
 }  // namespace v8::internal::wasm
 
 #endif  // V8_WASM_WASM_SERIALIZATION_H_
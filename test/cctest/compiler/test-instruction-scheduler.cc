@@ -107,6 +107,44 @@ TEST(DeoptInMiddleOfBasicBlock) {
   tester.EndBlock();
 }
 
+TEST(ScheduleBlocksConcurrently) {
+  HandleAndZoneScope scope(kCompressGraphZone);
+  Zone* zone = scope.main_zone();
+
+  // Build a number of blocks mixing loads, side effects and nops, terminated
+  // by a return.
+  constexpr size_t kBlockCount = 64;
+  const InstructionCode kOpcodes[] = {kArchNop, kArchStackPointerGreaterThan,
+                                      kArchPrepareTailCall};
+  std::vector<std::vector<Instruction*>> blocks(kBlockCount);
+  for (size_t i = 0; i < kBlockCount; ++i) {
+    for (size_t j = 0; j < 2 + i % 7; ++j) {
+      blocks[i].push_back(
+          Instruction::New(zone, kOpcodes[(i + j) % arraysize(kOpcodes)]));
+    }
+    blocks[i].push_back(Instruction::New(zone, kArchRet));
+  }
+
+  // Schedule a copy of every block one after another as the reference.
+  std::vector<std::vector<Instruction*>> expected = blocks;
+  InstructionScheduler sequential(zone, nullptr);
+  for (std::vector<Instruction*>& block : expected) {
+    sequential.ScheduleBlock(base::VectorOf(block));
+  }
+
+  std::vector<base::Vector<Instruction*>> block_vectors;
+  for (std::vector<Instruction*>& block : blocks) {
+    block_vectors.push_back(base::VectorOf(block));
+  }
+  InstructionScheduler::ScheduleBlocksConcurrently(
+      zone->allocator(), base::VectorOf(block_vectors));
+
+  for (size_t i = 0; i < kBlockCount; ++i) {
+    CHECK(blocks[i] == expected[i]);
+    CHECK_EQ(kArchRet, blocks[i].back()->arch_opcode());
+  }
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
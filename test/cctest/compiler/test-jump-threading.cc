@@ -7,6 +7,7 @@
 #include "src/compiler/backend/instruction.h"
 #include "src/compiler/backend/jump-threading.h"
 #include "test/cctest/cctest.h"
+#include "test/common/flag-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -782,6 +783,39 @@ void CheckAssemblyOrder(TestCode* code, int size, int* expected) {
   }
 }
 
+TEST(AssemblyOrderDeferredTiers) {
+  FlagScope<bool> order_deferred_blocks(
+      &v8_flags.turbo_order_deferred_blocks, true);
+  constexpr size_t kBlockCount = 5;
+  TestCode code(kBlockCount);
+
+  // B0
+  code.Branch(1, 2);
+  // B1
+  code.Return(0, true);
+  // B2
+  code.Branch(3, 4);
+  // B3
+  code.Defer();
+  code.Jump(4);
+  // B4
+  code.Return(0);
+
+  static int successors[][2] = {{1, 2}, {-1, -1}, {3, 4}, {4, -1}, {-1, -1}};
+  for (size_t i = 0; i < kBlockCount; i++) {
+    for (int succ : successors[i]) {
+      if (succ < 0) continue;
+      code.blocks_[i]->successors().push_back(RpoNumber::FromInt(succ));
+    }
+  }
+  code.sequence_.RecomputeAssemblyOrderForTesting();
+
+  // The deferred slow path B3 rejoins B4 and is placed before the terminal
+  // deferred block B1.
+  static int assembly[] = {0, 4, 1, 3, 2};
+  CheckAssemblyOrder(&code, kBlockCount, assembly);
+}
+
 TEST(Rewire1) {
   constexpr size_t kBlockCount = 3;
   TestCode code(kBlockCount);
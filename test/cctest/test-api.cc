@@ -8829,6 +8829,86 @@ THREADED_TEST(StringWrite) {
   CHECK_EQ(0, str->Write(isolate, nullptr, 0, 0, String::NO_NULL_TERMINATION));
 }
 
+namespace {
+
+char* ResizeToString(char* buffer, int used, int size, void* data) {
+  std::string* resized = static_cast<std::string*>(data);
+  CHECK(resized->empty());
+  resized->assign(buffer, used);
+  resized->resize(size);
+  return &(*resized)[0];
+}
+
+char* RefuseResize(char* buffer, int used, int size, void* data) {
+  return nullptr;
+}
+
+std::string WriteUtf8WithResize(v8::Isolate* isolate, Local<String> str,
+                                int capacity, int options) {
+  char buffer[16];
+  CHECK_LE(capacity, static_cast<int>(sizeof(buffer)));
+  std::string resized;
+  int written = str->WriteUtf8WithResize(isolate, buffer, capacity,
+                                         ResizeToString, &resized, options);
+  if (resized.empty()) return std::string(buffer, written);
+  CHECK_EQ(resized.size(), static_cast<size_t>(written));
+  return resized;
+}
+
+}  // namespace
+
+THREADED_TEST(StringWriteUtf8WithResize) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope scope(isolate);
+  // ASCII runs long enough to be copied in bulk, Latin-1, CJK and a surrogate
+  // pair, which must not be split between the buffers.
+  const char* cases[] = {
+      "",
+      "abcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ",
+      "abc\xC3\xB0\xC3\xA9" "abcdefghijklmnopqrstuvwxyz\xC3\xBF",
+      "\xE4\xB8\xAD\xE6\x96\x87" "abcdefghijklmnopqrstuvwxyz\xE2\x98\x83",
+      "a\xF0\x9F\x98\x80\xF0\x9F\x98\x80" "abcdefghijklmnop\xF0\x9F\x98\x80",
+  };
+  for (const char* utf8 : cases) {
+    Local<String> str = v8_str(utf8);
+    std::string expected(utf8);
+    CHECK_EQ(static_cast<int>(expected.size()), str->Utf8Length(isolate));
+    for (int capacity = 0; capacity <= 16; capacity++) {
+      for (int options : {String::NO_OPTIONS, String::REPLACE_INVALID_UTF8}) {
+        std::string result =
+            WriteUtf8WithResize(isolate, str, capacity, options);
+        CHECK_EQ(expected + '\0', result);
+        result = WriteUtf8WithResize(isolate, str, capacity,
+                                     options | String::NO_NULL_TERMINATION);
+        CHECK_EQ(expected, result);
+      }
+    }
+  }
+
+  // Cons strings are flattened once.
+  Local<String> cons =
+      String::Concat(isolate, v8_str(cases[1]), v8_str(cases[3]));
+  CHECK_EQ(std::string(cases[1]) + cases[3] + '\0',
+           WriteUtf8WithResize(isolate, cons, 8, String::NO_OPTIONS));
+
+  // "ab" + lead surrogate + "wx" + trail surrogate + "yz"
+  uint16_t orphans[8] = {0x61, 0x62, 0xD800, 0x77, 0x78, 0xDC00, 0x79, 0x7A};
+  Local<String> orphans_str =
+      String::NewFromTwoByte(isolate, orphans, v8::NewStringType::kNormal, 8)
+          .ToLocalChecked();
+  CHECK_EQ(std::string("ab\xEF\xBF\xBDwx\xEF\xBF\xBDyz"),
+           WriteUtf8WithResize(isolate, orphans_str, 3,
+                               String::NO_NULL_TERMINATION |
+                                   String::REPLACE_INVALID_UTF8));
+
+  // Writing stops if the callback doesn't provide a buffer.
+  char buffer[4];
+  CHECK_EQ(3, v8_str(cases[2])->WriteUtf8WithResize(
+                  isolate, buffer, sizeof(buffer), RefuseResize, nullptr));
+  CHECK_EQ(0, strncmp(buffer, "abc", 3));
+}
+
 static void Utf16Helper(LocalContext& context, const char* name,
                         const char* lengths_name, int len) {
   Local<v8::Array> a = Local<v8::Array>::Cast(
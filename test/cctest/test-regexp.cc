@@ -2,10 +2,13 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <string>
+
 #include "include/v8-function.h"
 #include "include/v8-regexp.h"
 #include "src/api/api-inl.h"
 #include "src/execution/frames-inl.h"
+#include "src/regexp/regexp-bytecode-cache.h"
 #include "test/cctest/cctest.h"
 #include "test/cctest/heap/heap-utils.h"
 
@@ -346,3 +349,125 @@ TEST(InterruptAndTransitionSubjectFromTwoByteToOneByte) {
       Cast<i::IrRegExpData>(regexp->data(i_isolate));
   CHECK(data->has_latin1_bytecode());
 }
+
+namespace {
+
+int budget_exceeded_count = 0;
+std::string budget_exceeded_source;
+int budget_exceeded_flags = 0;
+
+void OnRegExpBacktrackBudgetExceeded(Isolate* isolate, Local<String> source,
+                                     int flags) {
+  budget_exceeded_count++;
+  budget_exceeded_source = *String::Utf8Value(isolate, source);
+  budget_exceeded_flags = flags;
+}
+
+}  // namespace
+
+TEST(RegExpBacktrackBudget) {
+  i::v8_flags.enable_experimental_regexp_engine_on_excessive_backtracks = false;
+  LocalContext env;
+  Isolate* isolate = env->GetIsolate();
+  HandleScope scope(isolate);
+  isolate->SetRegExpBacktrackBudget(100);
+  isolate->SetRegExpBacktrackBudgetExceededCallback(
+      OnRegExpBacktrackBudgetExceeded);
+
+  // Catastrophic backtracking is cut short and the linear-time engine
+  // produces the result.
+  budget_exceeded_count = 0;
+  CHECK(CompileRun("/^(a+)+$/g.test('a'.repeat(40) + 'b')")->IsFalse());
+  CHECK_LT(0, budget_exceeded_count);
+  CHECK(budget_exceeded_source == "^(a+)+$");
+  CHECK_EQ(static_cast<int>(RegExp::kGlobal), budget_exceeded_flags);
+  CHECK(CompileRun("/^(a+)+$/.exec('aaaa')[1] === 'aaaa'")->IsTrue());
+
+  // Patterns the linear-time engine can't handle are not subject to the
+  // Isolate-wide budget.
+  budget_exceeded_count = 0;
+  CHECK(CompileRun("/^((a+)+)\\1$/.test('a'.repeat(12) + 'b')")->IsFalse());
+  CHECK_EQ(0, budget_exceeded_count);
+
+  isolate->SetRegExpBacktrackBudgetExceededCallback(nullptr);
+  isolate->SetRegExpBacktrackBudget(0);
+}
+
+TEST(RegExpBytecodeInCodeCache) {
+  i::v8_flags.regexp_bytecode_in_code_cache = true;
+  i::v8_flags.regexp_shared_bytecode_cache = true;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+
+  const char* source = "/(a+)b/.exec('xaab')[1]";
+  const char* pattern = "(a+)b";
+  i::RegExpBytecodeCache::Key key{
+      std::vector<base::uc16>(pattern, pattern + strlen(pattern)),
+      0,
+      true,
+      i::JSRegExp::kNoBacktrackLimit,
+      0,
+      i::FlagList::Hash()};
+  i::RegExpBytecodeCache::Clear();
+  ScriptCompiler::CachedData* cache;
+
+  // Executing the literal compiles it to bytecode, which is then shared with
+  // all isolates.
+  Isolate* isolate1 = Isolate::New(create_params);
+  {
+    Isolate::Scope isolate_scope(isolate1);
+    HandleScope scope(isolate1);
+    Local<Context> context = Context::New(isolate1);
+    Context::Scope context_scope(context);
+    ScriptCompiler::Source script_source(v8_str(source));
+    Local<Script> script =
+        ScriptCompiler::Compile(context, &script_source).ToLocalChecked();
+    CHECK(script->Run(context).ToLocalChecked()->StrictEquals(v8_str("aa")));
+    CHECK(i::RegExpBytecodeCache::Lookup(key).has_value());
+    cache = ScriptCompiler::CreateCodeCache(script->GetUnboundScript());
+  }
+  isolate1->Dispose();
+
+  // Consuming the code cache restores the bytecode in a fresh process.
+  i::RegExpBytecodeCache::Clear();
+  Isolate* isolate2 = Isolate::New(create_params);
+  {
+    Isolate::Scope isolate_scope(isolate2);
+    HandleScope scope(isolate2);
+    Local<Context> context = Context::New(isolate2);
+    Context::Scope context_scope(context);
+    ScriptCompiler::Source script_source(v8_str(source), cache);
+    Local<Script> script =
+        ScriptCompiler::Compile(context, &script_source,
+                                ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+    CHECK(i::RegExpBytecodeCache::Lookup(key).has_value());
+    CHECK(script->Run(context).ToLocalChecked()->StrictEquals(v8_str("aa")));
+  }
+  isolate2->Dispose();
+}
+
+TEST(RegExpBacktrackBudgetExceededAfterExperimentalTierUp) {
+  i::v8_flags.enable_experimental_regexp_engine = true;
+  i::v8_flags.experimental_regexp_engine_tier_up = true;
+  i::v8_flags.experimental_regexp_engine_tier_up_ticks = 1;
+  i::v8_flags.regexp_backtracks_before_fallback = 100;
+  if (i::v8_flags.jitless || i::v8_flags.regexp_interpret_all) return;
+  LocalContext env;
+  Isolate* isolate = env->GetIsolate();
+  HandleScope scope(isolate);
+  isolate->SetRegExpBacktrackBudgetExceededCallback(
+      OnRegExpBacktrackBudgetExceeded);
+
+  // Falling back from the native code of a tiered-up linear-time regexp is
+  // reported like any other fallback.
+  budget_exceeded_count = 0;
+  CompileRun("var re = /^(a+)+$/l; for (var i = 0; i < 4; ++i) re.exec('aa');");
+  CHECK_EQ(0, budget_exceeded_count);
+  CHECK(CompileRun("re.test('a'.repeat(40) + 'b')")->IsFalse());
+  CHECK_EQ(1, budget_exceeded_count);
+  CHECK(budget_exceeded_source == "^(a+)+$");
+
+  isolate->SetRegExpBacktrackBudgetExceededCallback(nullptr);
+}
@@ -32,6 +32,8 @@
 
 #include <stdlib.h>
 
+#include <string>
+
 #include "include/v8-json.h"
 #include "include/v8-template.h"
 #include "src/api/api-inl.h"
@@ -1029,6 +1031,45 @@ TEST(Utf8ConversionPerf) {
   delete[] buffer;
 }
 
+TEST(Utf8DecoderPerf) {
+  // Measures the throughput of decoding utf-8 into strings.
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  struct {
+    const char* name;
+    const char* unit;
+    int unit_length;  // In UTF-16 code units.
+  } inputs[] = {
+      {"ascii", "Content-Type: text/html; charset=utf-8\r\n", 40},
+      // "déjà vu café naïve "
+      {"latin1", "d\xC3\xA9j\xC3\xA0 vu caf\xC3\xA9 na\xC3\xAFve ", 19},
+      // "中文测试文本"
+      {"cjk", "\xE4\xB8\xAD\xE6\x96\x87\xE6\xB5\x8B\xE8\xAF\x95\xE6\x96\x87"
+              "\xE6\x9C\xAC",
+       6},
+  };
+  const int kRepeat = 100000;
+  const int kIterations = 10;
+  for (const auto& input : inputs) {
+    std::string utf8;
+    for (int i = 0; i < kRepeat; i++) utf8 += input.unit;
+    v8::base::ElapsedTimer timer;
+    timer.Start();
+    for (int i = 0; i < kIterations; i++) {
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::String> string =
+          v8::String::NewFromUtf8(isolate, utf8.data(),
+                                  v8::NewStringType::kNormal,
+                                  static_cast<int>(utf8.size()))
+              .ToLocalChecked();
+      CHECK_EQ(kRepeat * input.unit_length, string->Length());
+    }
+    double ms = timer.Elapsed().InMillisecondsF();
+    printf("%s %0.3f ms, %0.1f MB/s\n", input.name, ms,
+           kIterations * utf8.size() / (ms * 1000));
+  }
+}
+
 TEST(ExternalShortStringAdd) {
   LocalContext context;
   v8::HandleScope handle_scope(CcTest::isolate());
@@ -12,6 +12,7 @@
 #include "src/snapshot/code-serializer.h"
 #include "src/utils/version.h"
 #include "src/wasm/module-decoder.h"
+#include "src/wasm/module-instantiate.h"
 #include "src/wasm/wasm-engine.h"
 #include "src/wasm/wasm-module-builder.h"
 #include "src/wasm/wasm-module.h"
@@ -915,6 +916,250 @@ TEST(EmptyMemoryEmptyDataSegment) {
   Cleanup();
 }
 
+TEST(Run_WasmModule_InstanceSnapshot) {
+  {
+    static const int kPageSize = 0x10000;
+    static const int kIndex = kPageSize + 8;
+    TestSignatures sigs;
+    Isolate* isolate = CcTest::InitIsolateOnce();
+    Zone zone(isolate->allocator(), ZONE_NAME);
+
+    WasmModuleBuilder* builder = zone.New<WasmModuleBuilder>(&zone);
+    builder->AddMemory(1, 4);
+    uint32_t global = builder->AddGlobal(kWasmI32, true, WasmInitExpr(0));
+    static const uint8_t kActiveData[] = {11, 22, 33, 44};
+    builder->AddDataSegment(kActiveData, sizeof(kActiveData), 16);
+    static const uint8_t kPassiveData[] = {55, 66, 77, 88};
+    builder->AddPassiveDataSegment(kPassiveData, sizeof(kPassiveData));
+
+    // The start function grows the memory, writes to the new page, sets the
+    // global and drops the passive data segment.
+    WasmFunctionBuilder* start = builder->AddFunction(sigs.v_v());
+    uint8_t start_code[] = {
+        WASM_MEMORY_GROW(WASM_ONE), WASM_DROP,
+        WASM_STORE_MEM(MachineType::Int32(), WASM_I32V(kIndex),
+                       WASM_I32V(0x12345678)),
+        WASM_GLOBAL_SET(global, WASM_I32V(42)), WASM_DATA_DROP(1)};
+    EMIT_CODE_WITH_END(start, start_code);
+    builder->MarkStartFunction(start);
+
+    WasmFunctionBuilder* load = builder->AddFunction(sigs.i_i());
+    ExportAsMain(load);
+    uint8_t load_code[] = {
+        WASM_LOAD_MEM(MachineType::Int32(), WASM_LOCAL_GET(0))};
+    EMIT_CODE_WITH_END(load, load_code);
+
+    WasmFunctionBuilder* get_global = builder->AddFunction(sigs.i_v());
+    builder->AddExport(base::CStrVector("global"), get_global);
+    uint8_t get_global_code[] = {WASM_GLOBAL_GET(global)};
+    EMIT_CODE_WITH_END(get_global, get_global_code);
+
+    WasmFunctionBuilder* init = builder->AddFunction(sigs.i_v());
+    builder->AddExport(base::CStrVector("init"), init);
+    uint8_t init_code[] = {
+        WASM_MEMORY_INIT(1, WASM_ZERO, WASM_ZERO, WASM_I32V_1(4)), WASM_ONE};
+    EMIT_CODE_WITH_END(init, init_code);
+
+    HandleScope scope(isolate);
+    ZoneBuffer buffer(&zone);
+    builder->WriteTo(&buffer);
+    testing::SetupIsolateForWasmModule(isolate);
+
+    ErrorThrower thrower(isolate, "Test");
+    Handle<WasmInstanceObject> original =
+        CompileAndInstantiateForTesting(
+            isolate, &thrower, ModuleWireBytes(buffer.begin(), buffer.end()))
+            .ToHandleChecked();
+    std::unique_ptr<WasmInstanceSnapshot> snapshot =
+        WasmInstanceSnapshot::Create(isolate, original);
+    CHECK_NOT_NULL(snapshot);
+    // Only the first chunk of both pages is non-zero.
+    CHECK_EQ(size_t{8192}, snapshot->stored_memory_bytes());
+
+    // Modifying the original instance does not change the snapshot.
+    uint8_t* original_memory =
+        original->trusted_data(isolate)->memory_base(0);
+    WriteLittleEndianValue<int32_t>(
+        reinterpret_cast<Address>(original_memory + kIndex), 0x0BAD);
+
+    Handle<WasmModuleObject> module_object(
+        original->trusted_data(isolate)->module_object(), isolate);
+    Handle<WasmInstanceObject> instance =
+        InstantiateFromSnapshot(isolate, &thrower, module_object, {},
+                                *snapshot)
+            .ToHandleChecked();
+    CHECK_NE(*original, *instance);
+    CHECK_EQ(size_t{2 * kPageSize},
+             instance->trusted_data(isolate)->memory_size(0));
+
+    auto Load = [&](Handle<WasmInstanceObject> target, int index) {
+      Handle<Object> params[1] = {handle(Smi::FromInt(index), isolate)};
+      return testing::CallWasmFunctionForTesting(isolate, target, "main",
+                                                 base::ArrayVector(params));
+    };
+    CHECK_EQ(0x12345678, Load(instance, kIndex));
+    CHECK_EQ(0x0BAD, Load(original, kIndex));
+    CHECK_EQ(0x2C21160B, Load(instance, 16));
+    CHECK_EQ(42, testing::CallWasmFunctionForTesting(isolate, instance,
+                                                     "global", {}));
+
+    // The passive data segment was dropped by the start function.
+    std::unique_ptr<const char[]> exception;
+    CHECK_EQ(-1, testing::CallWasmFunctionForTesting(isolate, instance, "init",
+                                                     {}, &exception));
+    CHECK_NOT_NULL(exception);
+  }
+  Cleanup();
+}
+
+TEST(Run_WasmModule_InstanceSnapshotRestrictions) {
+  {
+    TestSignatures sigs;
+    Isolate* isolate = CcTest::InitIsolateOnce();
+    Zone zone(isolate->allocator(), ZONE_NAME);
+    HandleScope scope(isolate);
+    testing::SetupIsolateForWasmModule(isolate);
+    ErrorThrower thrower(isolate, "Test");
+
+    auto Instantiate = [&](WasmModuleBuilder* builder,
+                           MaybeHandle<JSReceiver> imports) {
+      ZoneBuffer buffer(&zone);
+      builder->WriteTo(&buffer);
+      Handle<WasmModuleObject> module_object =
+          testing::CompileForTesting(
+              isolate, &thrower, ModuleWireBytes(buffer.begin(), buffer.end()))
+              .ToHandleChecked();
+      return GetWasmEngine()
+          ->SyncInstantiate(isolate, &thrower, module_object, imports, {})
+          .ToHandleChecked();
+    };
+
+    // Code that can modify a table prevents snapshots, as tables are
+    // initialized from the module.
+    {
+      WasmModuleBuilder* builder = zone.New<WasmModuleBuilder>(&zone);
+      builder->AddTable(kWasmFuncRef, 1);
+      WasmFunctionBuilder* clear = builder->AddFunction(sigs.v_v());
+      builder->AddExport(base::CStrVector("clear"), clear);
+      uint8_t clear_code[] = {
+          WASM_TABLE_SET(0, WASM_ZERO, WASM_REF_NULL(kFuncRefCode))};
+      EMIT_CODE_WITH_END(clear, clear_code);
+      CHECK_NULL(WasmInstanceSnapshot::Create(isolate,
+                                              Instantiate(builder, {})));
+    }
+
+    // So does exporting a table.
+    {
+      WasmModuleBuilder* builder = zone.New<WasmModuleBuilder>(&zone);
+      uint32_t table = builder->AddTable(kWasmFuncRef, 1);
+      builder->AddExport(base::CStrVector("table"), kExternalTable, table);
+      CHECK_NULL(WasmInstanceSnapshot::Create(isolate,
+                                              Instantiate(builder, {})));
+    }
+
+    // The start function isn't run for instances created from a snapshot, so
+    // modules with a start function can't import functions, mutable globals,
+    // or memories, whose state the start function may have changed.
+    {
+      WasmModuleBuilder* builder = zone.New<WasmModuleBuilder>(&zone);
+      builder->AddImport(base::CStrVector("f"), sigs.v_v(),
+                         base::CStrVector("m"));
+      WasmFunctionBuilder* start = builder->AddFunction(sigs.v_v());
+      uint8_t start_code[] = {WASM_CALL_FUNCTION0(0)};
+      EMIT_CODE_WITH_END(start, start_code);
+      builder->MarkStartFunction(start);
+
+      WasmModuleBuilder* exporter = zone.New<WasmModuleBuilder>(&zone);
+      WasmFunctionBuilder* f = exporter->AddFunction(sigs.v_v());
+      uint8_t f_code[] = {WASM_NOP};
+      EMIT_CODE_WITH_END(f, f_code);
+      exporter->AddExport(base::CStrVector("f"), f);
+      Handle<WasmExportedFunction> exported_f =
+          testing::GetExportedFunction(isolate, Instantiate(exporter, {}), "f")
+              .ToHandleChecked();
+      Handle<JSObject> module_imports =
+          isolate->factory()->NewJSObject(isolate->object_function());
+      JSObject::AddProperty(isolate, module_imports, "f", exported_f, NONE);
+      Handle<JSObject> imports =
+          isolate->factory()->NewJSObject(isolate->object_function());
+      JSObject::AddProperty(isolate, imports, "m", module_imports, NONE);
+      CHECK_NULL(WasmInstanceSnapshot::Create(isolate,
+                                              Instantiate(builder, imports)));
+    }
+
+    {
+      WasmModuleBuilder* builder = zone.New<WasmModuleBuilder>(&zone);
+      uint32_t imported = builder->AddGlobalImport(
+          base::CStrVector("g"), kWasmI32, true, base::CStrVector("m"));
+      WasmFunctionBuilder* start = builder->AddFunction(sigs.v_v());
+      uint8_t start_code[] = {WASM_GLOBAL_SET(imported, WASM_I32V_1(7))};
+      EMIT_CODE_WITH_END(start, start_code);
+      builder->MarkStartFunction(start);
+
+      Handle<WasmGlobalObject> global =
+          WasmGlobalObject::New(isolate, Handle<WasmTrustedInstanceData>{},
+                                MaybeHandle<JSArrayBuffer>{},
+                                MaybeHandle<FixedArray>{}, kWasmI32, 0, true)
+              .ToHandleChecked();
+      Handle<JSObject> module_imports =
+          isolate->factory()->NewJSObject(isolate->object_function());
+      JSObject::AddProperty(isolate, module_imports, "g", global, NONE);
+      Handle<JSObject> imports =
+          isolate->factory()->NewJSObject(isolate->object_function());
+      JSObject::AddProperty(isolate, imports, "m", module_imports, NONE);
+      Handle<WasmInstanceObject> instance = Instantiate(builder, imports);
+      CHECK_EQ(7, global->GetI32());
+      CHECK_NULL(WasmInstanceSnapshot::Create(isolate, instance));
+    }
+
+    // Globals computed from imported globals are only restored if the
+    // imports provide the same values.
+    {
+      WasmModuleBuilder* builder = zone.New<WasmModuleBuilder>(&zone);
+      uint32_t imported = builder->AddGlobalImport(
+          base::CStrVector("g"), kWasmI32, false, base::CStrVector("m"));
+      uint32_t global = builder->AddGlobal(kWasmI32, false,
+                                           WasmInitExpr::GlobalGet(imported));
+      WasmFunctionBuilder* get_global = builder->AddFunction(sigs.i_v());
+      builder->AddExport(base::CStrVector("main"), get_global);
+      uint8_t get_global_code[] = {WASM_GLOBAL_GET(global)};
+      EMIT_CODE_WITH_END(get_global, get_global_code);
+
+      auto Imports = [&](int value) {
+        Handle<JSObject> module_imports =
+            isolate->factory()->NewJSObject(isolate->object_function());
+        JSObject::AddProperty(isolate, module_imports, "g",
+                              handle(Smi::FromInt(value), isolate), NONE);
+        Handle<JSObject> imports =
+            isolate->factory()->NewJSObject(isolate->object_function());
+        JSObject::AddProperty(isolate, imports, "m", module_imports, NONE);
+        return imports;
+      };
+
+      Handle<WasmInstanceObject> original = Instantiate(builder, Imports(5));
+      std::unique_ptr<WasmInstanceSnapshot> snapshot =
+          WasmInstanceSnapshot::Create(isolate, original);
+      CHECK_NOT_NULL(snapshot);
+      Handle<WasmModuleObject> module_object(
+          original->trusted_data(isolate)->module_object(), isolate);
+
+      Handle<WasmInstanceObject> instance =
+          InstantiateFromSnapshot(isolate, &thrower, module_object, Imports(5),
+                                  *snapshot)
+              .ToHandleChecked();
+      CHECK_EQ(5, testing::CallWasmFunctionForTesting(isolate, instance,
+                                                      "main", {}));
+
+      CHECK(InstantiateFromSnapshot(isolate, &thrower, module_object,
+                                    Imports(6), *snapshot)
+                .is_null());
+      CHECK(thrower.error());
+      thrower.Reset();
+    }
+  }
+  Cleanup();
+}
+
 #undef EMIT_CODE_WITH_END
 
 }  // namespace test_run_wasm_module
@@ -450,6 +450,28 @@ STREAM_TEST(TestCutAfterOneFunctionCompilerFinishesFirst) {
   CHECK(tester.IsPromiseFulfilled());
 }
 
+// Test that committing compilation units within a chunk, here after every
+// function body, compiles the module.
+STREAM_TEST(TestCommitUnitsWithinChunk) {
+  FlagScope<unsigned int> commit_after_each_function(
+      &v8_flags.wasm_streaming_commit_size, 0);
+  StreamTester tester(isolate);
+  ZoneBuffer buffer = GetValidModuleBytes(tester.zone());
+
+  tester.OnBytesReceived(buffer.begin(), buffer.size());
+  // The synchronous streaming decoder doesn't decode before the stream is
+  // finished.
+  if (v8_flags.wasm_async_compilation) {
+    StreamingProgress progress = tester.stream()->GetProgress();
+    CHECK_EQ(3, progress.total_functions);
+    CHECK_EQ(3, progress.received_functions);
+  }
+  tester.RunCompilerTasks();
+  tester.FinishStream();
+  tester.RunCompilerTasks();
+  CHECK(tester.IsPromiseFulfilled());
+}
+
 // Create a module with an invalid global section.
 ZoneBuffer GetModuleWithInvalidSection(Zone* zone) {
   ZoneBuffer buffer(zone);
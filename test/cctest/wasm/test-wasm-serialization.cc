@@ -10,6 +10,7 @@
 #include "src/objects/objects-inl.h"
 #include "src/snapshot/code-serializer.h"
 #include "src/utils/version.h"
+#include "src/wasm/module-compiler.h"
 #include "src/wasm/module-decoder.h"
 #include "src/wasm/wasm-engine.h"
 #include "src/wasm/wasm-module-builder.h"
@@ -444,6 +445,219 @@ TEST(DeserializeTieringBudgetPartlyMissing) {
   test.CollectGarbage();
 }
 
+TEST(CodeCacheDir) {
+  WasmSerializationTest test;
+  FLAG_VALUE_SCOPE(experimental_wasm_code_cache_dir, ".");
+
+  Isolate* isolate = CcTest::i_isolate();
+  base::Vector<const uint8_t> wire_bytes = base::VectorOf(test.wire_bytes());
+  CompileTimeImports compile_imports = test.MakeCompileTimeImports();
+  std::string path = GetCodeCacheDirEntryPath(wire_bytes);
+  base::OS::Remove(path.c_str());
+  {
+    HandleScope scope(isolate);
+    CHECK(ReadFromCodeCacheDir(isolate, wire_bytes, compile_imports).is_null());
+
+    Handle<WasmModuleObject> module_object;
+    CHECK(test.Deserialize().ToHandle(&module_object));
+    CHECK(WriteToCodeCacheDir(module_object->native_module()));
+  }
+  // We need to invoke GC without stack, otherwise some objects may survive.
+  {
+    DisableConservativeStackScanningScopeForTesting no_stack_scanning(
+        isolate->heap());
+    test.CollectGarbage();
+  }
+  {
+    HandleScope scope(isolate);
+    Handle<WasmModuleObject> module_object;
+    CHECK(ReadFromCodeCacheDir(isolate, wire_bytes, compile_imports)
+              .ToHandle(&module_object));
+    WasmCodeRefScope code_ref_scope;
+    WasmCode* turbofan_code = module_object->native_module()->GetCode(2);
+    CHECK_NOT_NULL(turbofan_code);
+    CHECK_EQ(ExecutionTier::kTurbofan, turbofan_code->tier());
+  }
+  CHECK(base::OS::Remove(path.c_str()));
+}
+
+namespace {
+class CodeCacheDirResolver : public CompilationResultResolver {
+ public:
+  explicit CodeCacheDirResolver(Handle<WasmModuleObject>* out_module_object)
+      : out_module_object_(out_module_object) {}
+  void OnCompilationSucceeded(Handle<WasmModuleObject> result) override {
+    *out_module_object_ = result;
+  }
+  void OnCompilationFailed(Handle<Object> error_reason) override {
+    UNREACHABLE();
+  }
+
+ private:
+  Handle<WasmModuleObject>* out_module_object_;
+};
+}  // namespace
+
+TEST(CodeCacheDirAsyncCompile) {
+  // Streaming compilation only writes to the cache directory.
+  if (v8_flags.wasm_test_streaming) return;
+  WasmSerializationTest test;
+  FLAG_VALUE_SCOPE(experimental_wasm_code_cache_dir, ".");
+
+  Isolate* isolate = CcTest::i_isolate();
+  base::Vector<const uint8_t> wire_bytes = base::VectorOf(test.wire_bytes());
+  std::string path = GetCodeCacheDirEntryPath(wire_bytes);
+  {
+    HandleScope scope(isolate);
+    Handle<WasmModuleObject> module_object;
+    CHECK(test.Deserialize().ToHandle(&module_object));
+    CHECK(WriteToCodeCacheDir(module_object->native_module()));
+  }
+  {
+    DisableConservativeStackScanningScopeForTesting no_stack_scanning(
+        isolate->heap());
+    test.CollectGarbage();
+  }
+  {
+    HandleScope scope(isolate);
+    // A hit in the cache directory resolves the compilation right away, with
+    // the TurboFan code of the cached module.
+    Handle<WasmModuleObject> module_object;
+    GetWasmEngine()->AsyncCompile(
+        isolate, WasmEnabledFeatures::FromIsolate(isolate),
+        test.MakeCompileTimeImports(),
+        std::make_shared<CodeCacheDirResolver>(&module_object),
+        ModuleWireBytes(wire_bytes), false, "CodeCacheDirAsyncCompile");
+    CHECK(!module_object.is_null());
+    WasmCodeRefScope code_ref_scope;
+    WasmCode* turbofan_code = module_object->native_module()->GetCode(2);
+    CHECK_NOT_NULL(turbofan_code);
+    CHECK_EQ(ExecutionTier::kTurbofan, turbofan_code->tier());
+  }
+  CHECK(base::OS::Remove(path.c_str()));
+}
+
+TEST(ProfileRoundTrip) {
+  WasmSerializationTest test;
+  HandleScope scope(CcTest::i_isolate());
+  Handle<WasmModuleObject> module_object;
+  CHECK(test.Deserialize().ToHandle(&module_object));
+  v8::CompiledWasmModule compiled_module =
+      v8::Utils::ToLocal(Cast<JSObject>(module_object))
+          .As<v8::WasmModuleObject>()
+          ->GetCompiledModule();
+
+  v8::OwnedBuffer profile = compiled_module.GetProfile();
+  CHECK_LT(0, profile.size);
+  CHECK(compiled_module.ApplyProfile({profile.buffer.get(), profile.size}));
+
+  // Truncated or malformed profiles are rejected.
+  CHECK(!compiled_module.ApplyProfile(
+      {profile.buffer.get(), profile.size - 1}));
+  std::vector<uint8_t> garbage(profile.size, 0xff);
+  CHECK(!compiled_module.ApplyProfile({garbage.data(), garbage.size()}));
+
+  // The profile starts with the hash of the wire bytes, so it is rejected for
+  // any other module.
+  std::vector<uint8_t> other_module(profile.buffer.get(),
+                                    profile.buffer.get() + profile.size);
+  other_module[0] ^= 1;
+  CHECK(!compiled_module.ApplyProfile(
+      {other_module.data(), other_module.size()}));
+
+  // Feedback that doesn't fit the function body is rejected: none of the
+  // functions contains a call, so a call target for function 0 is bogus.
+  // The profile is: wire bytes hash, no type feedback, one tiering byte per
+  // function.
+  CHECK_EQ(size_t{4 + 1 + 3}, profile.size);
+  std::vector<uint8_t> forged(profile.buffer.get(), profile.buffer.get() + 4);
+  forged.insert(forged.end(), {
+                                  1,  // num function entries
+                                  0,  // function index
+                                  1,  // feedback vector size
+                                  0,  // num cases
+                                  1,  // num call targets
+                                  1,  // call target
+                              });
+  forged.insert(forged.end(), profile.buffer.get() + 5,
+                profile.buffer.get() + profile.size);
+  CHECK(!compiled_module.ApplyProfile({forged.data(), forged.size()}));
+
+  // Applying a profile which says function 0 was tiered up compiles it with
+  // TurboFan in the background, which needs background threads.
+  if (v8_flags.liftoff_only || v8_flags.wasm_jitless ||
+      v8_flags.single_threaded || v8_flags.predictable) {
+    return;
+  }
+  NativeModule* native_module = module_object->native_module();
+  CHECK(!native_module->HasCodeWithTier(0, ExecutionTier::kTurbofan));
+  std::vector<uint8_t> tiered_up(profile.buffer.get(),
+                                 profile.buffer.get() + profile.size);
+  tiered_up[tiered_up.size() - 3] = 3;  // Executed and tiered up.
+  CHECK(compiled_module.ApplyProfile({tiered_up.data(), tiered_up.size()}));
+  base::TimeTicks deadline =
+      base::TimeTicks::Now() + base::TimeDelta::FromSeconds(30);
+  while (!native_module->HasCodeWithTier(0, ExecutionTier::kTurbofan)) {
+    CHECK_LT(base::TimeTicks::Now(), deadline);
+    base::OS::Sleep(base::TimeDelta::FromMilliseconds(1));
+  }
+  CHECK(!native_module->HasCodeWithTier(1, ExecutionTier::kTurbofan));
+}
+
+// Liftoff doesn't record call targets for calls in unreachable code, so such
+// calls must not make the profile of the module fail to apply.
+TEST(ProfileRoundTripWithUnreachableCall) {
+  if (v8_flags.liftoff_only || v8_flags.wasm_jitless) return;
+  Isolate* isolate = CcTest::InitIsolateOnce();
+  HandleScope scope(isolate);
+  testing::SetupIsolateForWasmModule(isolate);
+  AccountingAllocator allocator;
+  Zone zone(&allocator, ZONE_NAME);
+  ZoneBuffer buffer(&zone);
+  uint32_t caller_index;
+  {
+    WasmModuleBuilder builder(&zone);
+    TestSignatures sigs;
+    WasmFunctionBuilder* callee = builder.AddFunction(sigs.i_i());
+    uint8_t callee_code[] = {WASM_LOCAL_GET(0), WASM_END};
+    callee->EmitCode(callee_code, sizeof(callee_code));
+    WasmFunctionBuilder* caller = builder.AddFunction(sigs.i_i());
+    uint8_t caller_code[] = {
+        WASM_IF(WASM_I32_EQZ(WASM_LOCAL_GET(0)), WASM_UNREACHABLE,
+                WASM_CALL_FUNCTION(callee->func_index(), WASM_LOCAL_GET(0)),
+                WASM_DROP),
+        WASM_CALL_FUNCTION(callee->func_index(), WASM_LOCAL_GET(0)), WASM_END};
+    caller->EmitCode(caller_code, sizeof(caller_code));
+    caller_index = caller->func_index();
+    builder.AddExport(base::CStrVector("main"), caller);
+    builder.WriteTo(&buffer);
+  }
+
+  ErrorThrower thrower(isolate, "ProfileRoundTripWithUnreachableCall");
+  Handle<WasmInstanceObject> instance =
+      testing::CompileAndInstantiateForTesting(
+          isolate, &thrower, ModuleWireBytes(buffer.begin(), buffer.end()))
+          .ToHandleChecked();
+  Handle<Object> params[1] = {handle(Smi::FromInt(7), isolate)};
+  CHECK_EQ(7, testing::CallWasmFunctionForTesting(isolate, instance, "main",
+                                                  base::ArrayVector(params)));
+  // Tiering up processes the feedback Liftoff collected for the caller.
+  TierUpNowForTesting(isolate, instance->trusted_data(isolate), caller_index);
+
+  v8::CompiledWasmModule compiled_module =
+      v8::Utils::ToLocal(
+          Cast<JSObject>(handle(instance->module_object(), isolate)))
+          .As<v8::WasmModuleObject>()
+          ->GetCompiledModule();
+  v8::OwnedBuffer profile = compiled_module.GetProfile();
+  // The profile has type feedback for the caller (after the wire bytes hash).
+  if (instance->module_object()->native_module()->enabled_features()
+          .has_inlining()) {
+    CHECK_EQ(1, profile.buffer[4]);
+  }
+  CHECK(compiled_module.ApplyProfile({profile.buffer.get(), profile.size}));
+}
+
 TEST(SerializationFailsOnChangedFlags) {
   WasmSerializationTest test;
   {
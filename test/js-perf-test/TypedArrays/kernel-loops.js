@@ -0,0 +1,65 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Hand-written map/reduce/fill/copy loops over typed arrays, i.e. the inner
+// loops that Turboshaft unrolls more aggressively with
+// --turboshaft-unroll-typed-array-loops.
+
+const SIZE = 4096;
+let input;
+let output;
+let result;
+
+function Setup() {
+  input = new Float64Array(SIZE);
+  output = new Float64Array(SIZE);
+  for (let i = 0; i < SIZE; i++) input[i] = i;
+}
+
+function MapKernel() {
+  for (let i = 0; i < SIZE; i++) output[i] = input[i] * 2 + 1;
+}
+
+function MapTearDown() {
+  for (let i = 0; i < SIZE; i++) {
+    if (output[i] !== i * 2 + 1) throw new TypeError('Unexpected result!');
+  }
+}
+
+function ReduceKernel() {
+  let sum = 0;
+  for (let i = 0; i < SIZE; i++) sum += input[i];
+  result = sum;
+}
+
+function ReduceTearDown() {
+  if (result !== SIZE * (SIZE - 1) / 2) {
+    throw new TypeError(`Unexpected result!\n${result}`);
+  }
+}
+
+function FillKernel() {
+  for (let i = 0; i < SIZE; i++) output[i] = 42;
+}
+
+function FillTearDown() {
+  for (let i = 0; i < SIZE; i++) {
+    if (output[i] !== 42) throw new TypeError('Unexpected result!');
+  }
+}
+
+function CopyKernel() {
+  for (let i = 0; i < SIZE; i++) output[i] = input[i];
+}
+
+function CopyTearDown() {
+  for (let i = 0; i < SIZE; i++) {
+    if (output[i] !== i) throw new TypeError('Unexpected result!');
+  }
+}
+
+createSuite('Map', 1000, MapKernel, Setup, MapTearDown);
+createSuite('Reduce', 1000, ReduceKernel, Setup, ReduceTearDown);
+createSuite('Fill', 1000, FillKernel, Setup, FillTearDown);
+createSuite('Copy', 1000, CopyKernel, Setup, CopyTearDown);
@@ -0,0 +1,46 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --maglev-bounds-check-elimination
+// Flags: --no-always-turbofan
+
+// Repeated accesses with the same index only need a single bounds check.
+function addInPlace(a, b) {
+  for (let i = 0; i < a.length; i++) {
+    a[i] = a[i] + b[i];
+  }
+  return a;
+}
+
+%PrepareFunctionForOptimization(addInPlace);
+assertEquals([3, 5, 7], Array.from(addInPlace(new Int32Array([1, 2, 3]),
+                                              new Int32Array([2, 3, 4]))));
+%OptimizeMaglevOnNextCall(addInPlace);
+assertEquals([3, 5, 7], Array.from(addInPlace(new Int32Array([1, 2, 3]),
+                                              new Int32Array([2, 3, 4]))));
+assertTrue(isMaglevved(addInPlace));
+
+// The bounds check for `b` must not be eliminated by the one for `a`.
+assertEquals([3, 5, 0], Array.from(addInPlace(new Int32Array([1, 2, 3]),
+                                              new Int32Array([2, 3]))));
+assertFalse(isMaglevved(addInPlace));
+
+// A loop invariant bounds check may be hoisted out of the loop, but must still
+// behave as if it was executed in the loop.
+function sumFirst(a, k, n) {
+  let sum = 0;
+  for (let i = 0; i < n; i++) {
+    sum += a[k];
+  }
+  return sum;
+}
+
+%PrepareFunctionForOptimization(sumFirst);
+let arr = new Float64Array([1.5, 2.5]);
+assertEquals(3, sumFirst(arr, 0, 2));
+%OptimizeMaglevOnNextCall(sumFirst);
+assertEquals(7.5, sumFirst(arr, 1, 3));
+assertTrue(isMaglevved(sumFirst));
+assertEquals(0, sumFirst(arr, 2, 0));
+assertTrue(isNaN(sumFirst(arr, 2, 3)));
@@ -0,0 +1,41 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --maglev-object-tracking
+// Flags: --no-always-turbofan
+
+function deopt(o) {
+  %DeoptimizeNow();
+  return o;
+}
+
+// Loads of double fields of a non-escaping literal are scalar replaced, but
+// the object must still be rematerialized correctly on deopt.
+function norm(x, d) {
+  const p = {x: 1.5, y: 2.5};
+  let r = p.x * x + p.y;
+  if (d) return deopt(p);
+  return r;
+}
+
+%PrepareFunctionForOptimization(norm);
+assertEquals(4, norm(1, false));
+assertEquals(5.5, norm(2, false));
+%OptimizeMaglevOnNextCall(norm);
+assertEquals(4, norm(1, false));
+assertTrue(isMaglevved(norm));
+assertEquals({x: 1.5, y: 2.5}, norm(1, true));
+
+// A store to a double field escapes the object, later loads must see it.
+function update(v) {
+  const p = {x: 1.5, y: 2.5};
+  p.x = v;
+  return p.x + p.y;
+}
+
+%PrepareFunctionForOptimization(update);
+assertEquals(3, update(0.5));
+%OptimizeMaglevOnNextCall(update);
+assertEquals(4, update(1.5));
+assertEquals(5.25, update(2.75));
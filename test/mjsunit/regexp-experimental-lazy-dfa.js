@@ -0,0 +1,49 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --enable-experimental-regexp-engine
+// Flags: --experimental-regexp-engine-lazy-dfa
+// Flags: --experimental-regexp-engine-dfa-max-states=16
+
+// The lazy DFA only decides whether the NFA has to run at all, so the results
+// have to agree with the backtracking engine. Small state limits make some of
+// the patterns below fall back to the NFA. DFAs are kept across executions,
+// so later subjects run on DFAs that earlier ones partially built.
+
+const patterns = [
+  'abc', 'a|b|c', 'x*y', 'x*?y', '(a|ab)(c|bcd)', '[0-9]{4}-[0-9]{2}',
+  '(?:a*)*b', '(a*)+$', '(?:x|)*', 'e+rror:? (\\w+)', 'a[^b]{3,5}c',
+  '(?:(a)|b)+c', '[ab]*(?:aab|bba)[ab]*z',
+];
+
+const subjects = [
+  '', 'abc', 'xxxxy', 'aabcd', 'log 2024-01 error: disk', 'bbbbbbbbbbbb',
+  'abababababababaabz', 'no match here at all '.repeat(20),
+  'eeeeeeror error  errorx', 'axxxc ayyyyyc azc', 'Ⅻ abc Ⅻ',
+];
+
+function ExecAll(regexp, subject) {
+  const results = [];
+  regexp.lastIndex = 0;
+  let match;
+  while ((match = regexp.exec(subject)) !== null) {
+    results.push([match.index, ...match]);
+    if (!regexp.global) break;
+    if (match[0].length == 0) regexp.lastIndex++;
+  }
+  return results;
+}
+
+for (const pattern of patterns) {
+  for (const flags of ['', 'g']) {
+    const experimental = new RegExp(pattern, flags + 'l');
+    const backtracking = new RegExp(pattern, flags);
+    assertEquals('EXPERIMENTAL', %RegexpTypeTag(experimental));
+    for (const subject of subjects) {
+      assertEquals(ExecAll(backtracking, subject),
+                   ExecAll(experimental, subject),
+                   `/${pattern}/${flags} on '${subject}'`);
+    }
+  }
+}
@@ -0,0 +1,56 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --enable-experimental-regexp-engine
+// Flags: --experimental-regexp-engine-parallel-global-match
+// Flags: --experimental-regexp-engine-parallel-global-match-min-length=100
+
+// Global replacements search subjects above the minimum length in chunks on
+// several threads. Matches crossing chunk boundaries and zero-length matches
+// have to be stitched together exactly like in a sequential search, so the
+// results have to agree with the backtracking engine.
+
+const patterns = [
+  'a+', 'aa', 'b*', 'x', '(a)(b)?', 'ab|ba', '[0-9]+-[0-9]+', '(?:ab)*c',
+  '\\ba\\w*', '$', 'a{3,7}?', '(a|ab)(c|bcd)',
+];
+
+function MakeSubject(length, alphabet) {
+  let subject = '';
+  let seed = 17;
+  while (subject.length < length) {
+    seed = (seed * 1103515245 + 12345) % 2147483648;
+    const run = 1 + (seed >> 8) % 40;
+    subject += alphabet[(seed >> 16) % alphabet.length].repeat(run);
+  }
+  return subject.substring(0, length);
+}
+
+const subjects = [
+  MakeSubject(5000, ['a', 'b', 'c', ' ', '1-2']),
+  MakeSubject(4097, ['a', 'ab', 'bcd', 'Ⅴ']),
+  'a'.repeat(3001),
+  'c'.repeat(2000) + 'ab',
+];
+
+function Matches(regexp, subject) {
+  const results = [];
+  subject.replace(regexp, (...args) => {
+    results.push(args.slice(0, -1));
+    return '';
+  });
+  return results;
+}
+
+for (const pattern of patterns) {
+  const experimental = new RegExp(pattern, 'gl');
+  const backtracking = new RegExp(pattern, 'g');
+  assertEquals('EXPERIMENTAL', %RegexpTypeTag(experimental));
+  for (const subject of subjects) {
+    assertEquals(Matches(backtracking, subject),
+                 Matches(experimental, subject), `/${pattern}/g`);
+    assertEquals(subject.replace(backtracking, '<$&>'),
+                 subject.replace(experimental, '<$&>'), `/${pattern}/g`);
+  }
+}
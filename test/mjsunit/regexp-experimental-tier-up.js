@@ -0,0 +1,63 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --enable-experimental-regexp-engine
+// Flags: --experimental-regexp-engine-tier-up
+// Flags: --experimental-regexp-engine-tier-up-ticks=2
+// Flags: --regexp-backtracks-before-fallback=1000 --no-regexp-interpret-all
+
+const kLatin1 = true;
+const kUnicode = false;
+
+(function TestTierUpPerRepresentation() {
+  const re = new RegExp('(a+)b', 'l');
+  assertEquals('EXPERIMENTAL', %RegexpTypeTag(re));
+  for (let i = 0; i < 4; ++i) {
+    assertEquals(['aab', 'aa'], re.exec('xaab'));
+  }
+  assertTrue(%RegexpHasNativeCode(re, kLatin1));
+  assertFalse(%RegexpHasNativeCode(re, kUnicode));
+
+  for (let i = 0; i < 2; ++i) {
+    assertEquals(['aab', 'aa'], re.exec('πaab'));
+  }
+  assertTrue(%RegexpHasNativeCode(re, kUnicode));
+  // The regexp keeps its linear-time semantics.
+  assertEquals('EXPERIMENTAL', %RegexpTypeTag(re));
+})();
+
+(function TestGlobal() {
+  const re = new RegExp('[0-9]+', 'gl');
+  for (let i = 0; i < 4; ++i) {
+    assertEquals(['1', '22', '333'], 'a1b22c333'.match(re));
+    assertEquals('a-b-c-', 'a1b22c333'.replace(re, '-'));
+    re.lastIndex = 0;
+    assertEquals(['22'], re.exec('bb22'));
+    assertEquals(4, re.lastIndex);
+    re.lastIndex = 0;
+  }
+  assertTrue(%RegexpHasNativeCode(re, kLatin1));
+})();
+
+(function TestFallbackOnExcessiveBacktracking() {
+  // Catastrophic for a backtracking engine. The native code gives up after
+  // the backtrack budget and the experimental engine finishes the match.
+  const re = new RegExp('^(a+)+$', 'l');
+  const subject = 'a'.repeat(40) + 'b';
+  for (let i = 0; i < 4; ++i) {
+    assertEquals(['aaaa', 'aaaa'], re.exec('aaaa'));
+  }
+  assertTrue(%RegexpHasNativeCode(re, kLatin1));
+
+  // The first fallback drops the native code, and the regexp doesn't tier up
+  // again.
+  assertFalse(re.test(subject));
+  assertFalse(%RegexpHasNativeCode(re, kLatin1));
+  for (let i = 0; i < 4; ++i) {
+    assertFalse(re.test(subject));
+    assertEquals(['aaaa', 'aaaa'], re.exec('aaaa'));
+  }
+  assertFalse(%RegexpHasNativeCode(re, kLatin1));
+  assertEquals('EXPERIMENTAL', %RegexpTypeTag(re));
+})();
@@ -0,0 +1,39 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-tier-up --regexp-tier-up-ticks=1
+
+// Greedy loops whose continuation can't start with a character matched by the
+// loop body don't step back into the loop. The results have to be the same
+// as with stepping back, both in the interpreter and in native code.
+
+function test(expected, regexp, subject) {
+  // The first execution runs bytecode, the later ones native code.
+  for (let i = 0; i < 3; i++) {
+    assertEquals(expected, regexp.exec(subject), `${regexp} on ${subject}`);
+  }
+}
+
+// Possessive-equivalent loops.
+test(['abc1'], /[a-z]+[0-9]/, 'ABabc1');
+test(null, /[a-z]+[0-9]/, 'abcdefghijklmnop');
+test(['xyz-', 'xyz'], /([a-z]+)-/, '--xyz-');
+test(['aaab'], /a+b/, 'aaaaaaaaaac aaab');
+test(['foo bar'], /\w+ \w+/, 'foo bar');
+test(['AbC1'], /[a-z]+\d/i, 'AbC1');
+test(['ab1'], /[a-z]+(?=\d)\d/, 'ab1');
+test(['ab!'], /[a-z]+(?![a-z])!/, 'ab!');
+test(['ab1', 'ab'], /([a-z]*)[0-9]/, 'ab1');
+test(['1'], /[a-z]*[0-9]/, '1');
+
+// The continuation overlaps with the loop body, so stepping back is needed.
+test(['abc'], /[a-z]+c/, 'abc');
+test(['aaa'], /a+a/, 'aaa');
+test(['abcd', 'abc'], /([a-z]+)d/, 'abcd');
+test(['Abc', 'Ab'], /([a-z]+)C/i, 'Abc');
+test(['aab'], /[ab]+b/, 'aab');
+test(['abab', 'ab'], /([a-z]+)\1/, 'abab');
+test(['ab', 'a'], /([a-z]+)(?=b)b/, 'ab');
+test(['x1y'], /[^y]+y/, 'x1y');
+test(['ab'], /[a-z]+$/m, 'ab');
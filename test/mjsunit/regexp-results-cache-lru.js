@@ -0,0 +1,33 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --expose-gc --regexp-results-cache
+
+// Enough distinct subjects to evict entries and grow the results cache.
+const kSubjects = 600;
+const subjects = [];
+for (let i = 0; i < kSubjects; ++i) {
+  subjects.push(%ConstructInternalizedString(`k${i},v${i * 7},x`));
+}
+
+function Check() {
+  for (let round = 0; round < 3; ++round) {
+    for (let i = 0; i < kSubjects; ++i) {
+      const split = subjects[i].split(',');
+      assertEquals([`k${i}`, `v${i * 7}`, 'x'], split);
+      const matches = subjects[i].match(/[0-9]+/g);
+      assertEquals(i == 0 ? ['0', '0'] : [`${i}`, `${i * 7}`], matches);
+    }
+    // Recently used entries are looked up again.
+    for (let i = 0; i < 8; ++i) {
+      assertEquals(['k3', 'v21', 'x'], subjects[3].split(','));
+    }
+  }
+}
+
+Check();
+gc({type: 'minor'});
+Check();
+gc();
+Check();
@@ -0,0 +1,41 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-tier-up-ticks=0
+
+// Tests the (vectorized) skipping to a single required character, which
+// Boyer-Moore lookahead emits for patterns like the ones below.
+
+function check(re, subject, expected_index) {
+  re.lastIndex = 0;
+  const match = re.exec(subject);
+  if (expected_index < 0) {
+    assertNull(match);
+  } else {
+    assertNotNull(match);
+    assertEquals(expected_index, match.index);
+  }
+}
+
+const patterns = [/[a-c][d-f][g-i]x/, /[a-c][d-f][g-i]x/g, /.[0-9]{3}:/];
+
+function testSubjects(filler) {
+  for (let length = 0; length < 80; ++length) {
+    const prefix = filler.repeat(length);
+    check(patterns[0], prefix + 'adgx' + filler, length);
+    check(patterns[1], prefix + 'adgx', length);
+    check(patterns[2], prefix + 'a123:' + filler, length);
+    // The required character occurs, but the rest does not match.
+    check(patterns[0], prefix + 'zzzx' + filler + 'adgx', length + 5);
+    check(patterns[0], prefix + 'adg', -1);
+    check(patterns[2], prefix + 'a12:', -1);
+    // Characters that are equal to the required character modulo the table
+    // size must not be skipped incorrectly.
+    check(patterns[0], prefix + '\xf8adgx', length + 1);
+  }
+}
+
+testSubjects('-');
+testSubjects(' ');
+testSubjects('Ÿ');  // Equal to 'x' modulo 128.
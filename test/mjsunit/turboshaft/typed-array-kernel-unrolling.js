@@ -0,0 +1,58 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbofan --no-always-turbofan
+// Flags: --turboshaft-unroll-typed-array-loops
+
+// Inner loops over typed arrays are unrolled by a larger factor. The results
+// have to be the same for trip counts that aren't a multiple of the unrolling
+// factor, and when the loop is left early.
+
+function scale(dst, src, factor, length) {
+  for (let i = 0; i < length; i++) {
+    dst[i] = src[i] * factor + 1;
+  }
+}
+
+function sum(array, length) {
+  let result = 0;
+  for (let i = 0; i < length; i++) {
+    result += array[i];
+  }
+  return result;
+}
+
+function findFirstAbove(array, limit) {
+  for (let i = 0; i < array.length; i++) {
+    if (array[i] > limit) return i;
+  }
+  return -1;
+}
+
+function test() {
+  for (const length of [0, 1, 7, 8, 9, 15, 16, 17, 100, 1001]) {
+    const src = new Float64Array(length);
+    const dst = new Float64Array(length);
+    for (let i = 0; i < length; i++) src[i] = i;
+    scale(dst, src, 2, length);
+    for (let i = 0; i < length; i++) assertEquals(2 * i + 1, dst[i]);
+    assertEquals(length * length, sum(dst, length));
+
+    const ints = new Int32Array(length);
+    for (let i = 0; i < length; i++) ints[i] = i;
+    assertEquals(length > 6 ? 6 : -1, findFirstAbove(ints, 5));
+  }
+}
+
+%PrepareFunctionForOptimization(scale);
+%PrepareFunctionForOptimization(sum);
+%PrepareFunctionForOptimization(findFirstAbove);
+test();
+%OptimizeFunctionOnNextCall(scale);
+%OptimizeFunctionOnNextCall(sum);
+%OptimizeFunctionOnNextCall(findFirstAbove);
+test();
+assertOptimized(scale);
+assertOptimized(sum);
+assertOptimized(findFirstAbove);
@@ -0,0 +1,44 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --wasm-lazy-compilation
+// Flags: --wasm-lazy-background-compilation --no-wasm-lazy-validation
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+function buildModule(num_functions) {
+  const builder = new WasmModuleBuilder();
+  for (let i = 0; i < num_functions; ++i) {
+    builder.addFunction('f' + i, kSig_i_i)
+        .addBody([kExprLocalGet, 0, ...wasmI32Const(i), kExprI32Add])
+        .exportFunc();
+  }
+  return builder;
+}
+
+(function testFunctionsGetCompiledInBackground() {
+  print(arguments.callee.name);
+  const kNumFunctions = 20;
+  const exports = buildModule(kNumFunctions).instantiate().exports;
+  // The first call works regardless of whether background compilation
+  // finished.
+  assertEquals(42, exports.f2(40));
+  // All functions eventually get compiled without being called.
+  for (let i = 0; i < kNumFunctions; ++i) {
+    while (%IsUncompiledWasmFunction(exports['f' + i])) {}
+    assertTrue(%IsLiftoffFunction(exports['f' + i]));
+  }
+  for (let i = 0; i < kNumFunctions; ++i) {
+    assertEquals(i + 1, exports['f' + i](1));
+  }
+})();
+
+(function testReinstantiation() {
+  print(arguments.callee.name);
+  const module = buildModule(3).toModule();
+  const instance1 = new WebAssembly.Instance(module);
+  const instance2 = new WebAssembly.Instance(module);
+  assertEquals(3, instance1.exports.f2(1));
+  assertEquals(3, instance2.exports.f1(2));
+})();
@@ -0,0 +1,82 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --liftoff-only --liftoff-loop-analysis
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+(function testLoopInvariantLocals() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  // Locals: 3 = i, 4 = acc, 5 = facc. Only the params are loop-invariant.
+  const sig = makeSig([kWasmI32, kWasmI32, kWasmF64], [kWasmF64]);
+  builder.addFunction('sum', sig)
+      .addLocals(kWasmI32, 2)
+      .addLocals(kWasmF64, 1)
+      .addBody([
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 4, kExprLocalGet, 1, kExprI32Add, kExprLocalSet, 4,
+          kExprLocalGet, 5, kExprLocalGet, 2, kExprF64Add, kExprLocalSet, 5,
+          kExprLocalGet, 3, kExprI32Const, 1, kExprI32Add, kExprLocalTee, 3,
+          kExprLocalGet, 0, kExprI32LtS,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 5, kExprLocalGet, 4, kExprF64SConvertI32, kExprF64Add
+      ])
+      .exportFunc();
+  const instance = builder.instantiate();
+  assertTrue(%IsLiftoffFunction(instance.exports.sum));
+  assertEquals(10 * 3 + 10 * 0.5, instance.exports.sum(10, 3, 0.5));
+  assertEquals(1 * 7 + 1 * 1.5, instance.exports.sum(1, 7, 1.5));
+})();
+
+(function testLoopInvariantLocalsAcrossCalls() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const inc = builder.addImport('m', 'inc', kSig_i_i);
+  // Locals: 2 = i, 3 = acc. The call clobbers all cache registers.
+  builder.addFunction('sum', kSig_i_ii)
+      .addLocals(kWasmI32, 2)
+      .addBody([
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 3, kExprCallFunction, inc,
+          kExprLocalGet, 1, kExprI32Add, kExprLocalSet, 3,
+          kExprLocalGet, 2, kExprI32Const, 1, kExprI32Add, kExprLocalTee, 2,
+          kExprLocalGet, 0, kExprI32LtS,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 3
+      ])
+      .exportFunc();
+  const instance = builder.instantiate({m: {inc: x => x + 1}});
+  assertTrue(%IsLiftoffFunction(instance.exports.sum));
+  assertEquals(10 * (5 + 1), instance.exports.sum(10, 5));
+})();
+
+(function testNestedLoops() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  // Params: 0 = n, 1 = m, 2 = step. Locals: 3 = i, 4 = j, 5 = acc.
+  builder.addFunction('sum', kSig_i_iii)
+      .addLocals(kWasmI32, 3)
+      .addBody([
+        kExprLoop, kWasmVoid,
+          kExprI32Const, 0, kExprLocalSet, 3,
+          kExprLoop, kWasmVoid,
+            kExprLocalGet, 5, kExprLocalGet, 2, kExprI32Add, kExprLocalSet, 5,
+            kExprLocalGet, 3, kExprI32Const, 1, kExprI32Add, kExprLocalTee, 3,
+            kExprLocalGet, 0, kExprI32LtS,
+            kExprBrIf, 0,
+          kExprEnd,
+          kExprLocalGet, 4, kExprI32Const, 1, kExprI32Add, kExprLocalTee, 4,
+          kExprLocalGet, 1, kExprI32LtS,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 5
+      ])
+      .exportFunc();
+  const instance = builder.instantiate();
+  assertTrue(%IsLiftoffFunction(instance.exports.sum));
+  assertEquals(4 * 6 * 3, instance.exports.sum(4, 6, 3));
+})();
@@ -0,0 +1,63 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --experimental-wasm-memory64
+// Flags: --wasm-bounds-check-elimination
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+const kNumElements = 1000;
+
+function fillMemory(memory) {
+  const array = new BigInt64Array(memory.buffer);
+  for (let i = 0; i < kNumElements; ++i) array[i] = BigInt(i);
+}
+
+(function testInductionVariableLoop() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  builder.addMemory64(1, 1);
+  builder.exportMemoryAs('memory');
+  // Locals: 0 = i, 1 = acc. The loaded index is bounded by 999 * 8.
+  builder.addFunction('sum', makeSig([], [kWasmI64]))
+      .addLocals(kWasmI64, 2)
+      .addBody([
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 1,
+          kExprLocalGet, 0, kExprI64Const, 3, kExprI64Shl,
+          kExprI64LoadMem, 3, 0,
+          kExprI64Add, kExprLocalSet, 1,
+          kExprLocalGet, 0, kExprI64Const, 1, kExprI64Add, kExprLocalTee, 0,
+          ...wasmI64Const(kNumElements), kExprI64LtU,
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 1
+      ])
+      .exportFunc();
+  const instance = builder.instantiate();
+  fillMemory(instance.exports.memory);
+  const expected = BigInt(kNumElements * (kNumElements - 1) / 2);
+  assertEquals(expected, instance.exports.sum());
+  %WasmTierUpFunction(instance.exports.sum);
+  assertEquals(expected, instance.exports.sum());
+})();
+
+(function testUnboundedIndexStillTraps() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  builder.addMemory64(1, 1);
+  builder.exportMemoryAs('memory');
+  builder.addFunction('load', makeSig([kWasmI64], [kWasmI64]))
+      .addBody([
+        kExprLocalGet, 0, kExprI64Const, 3, kExprI64Shl,
+        kExprI64LoadMem, 3, 0
+      ])
+      .exportFunc();
+  const instance = builder.instantiate();
+  fillMemory(instance.exports.memory);
+  %WasmTierUpFunction(instance.exports.load);
+  assertEquals(7n, instance.exports.load(7n));
+  assertTraps(kTrapMemOutOfBounds, () => instance.exports.load(1n << 40n));
+  assertTraps(kTrapMemOutOfBounds, () => instance.exports.load(-1n));
+})();
@@ -416,6 +416,95 @@ INSTANTIATE_TEST_SUITE_P(LoopUnrollingAnalyzerTest,
                          LoopUnrollingAnalyzerOverflowTest,
                          ::testing::ValuesIn(kUnderOverflowBoundedLoops));
 
+template <typename AssemblerT>
+void EmitTypedArrayLoop(AssemblerT& Asm, bool raw_accesses) {
+  V<Object> array = Asm.GetParameter(0);
+  V<WordPtr> data = __ BitcastTaggedToWordPtr(array);
+  ScopedVar<Word32, typename AssemblerT::Assembler> index(&Asm, 0);
+
+  WHILE(__ Int32LessThan(index, __ Word32Constant(1000))) {
+    __ JSLoopStackCheck(__ NoContextConstant(), Asm.BuildFrameState());
+
+    V<WordPtr> offset = __ ChangeInt32ToIntPtr(index);
+    if (raw_accesses) {
+      V<Float64> value =
+          __ Load(data, offset, LoadOp::Kind::RawAligned(),
+                  MemoryRepresentation::Float64(), 0, kDoubleSizeLog2);
+      __ Store(data, offset, __ Float64Add(value, value),
+               StoreOp::Kind::RawAligned(), MemoryRepresentation::Float64(),
+               WriteBarrierKind::kNoWriteBarrier, 0, kDoubleSizeLog2);
+    } else {
+      V<Object> value =
+          __ Load(array, offset, LoadOp::Kind::TaggedBase(),
+                  MemoryRepresentation::AnyTagged(), 0, kTaggedSizeLog2);
+      __ Store(array, offset, value, StoreOp::Kind::TaggedBase(),
+               MemoryRepresentation::AnyTagged(),
+               WriteBarrierKind::kFullWriteBarrier, 0, kTaggedSizeLog2);
+    }
+
+    index = __ Word32Add(index, 1);
+  }
+
+  __ Return(index);
+}
+
+// Checking that loops that only do arithmetic and raw memory accesses are
+// recognized as typed array kernels, and get a larger unrolling factor.
+TEST_F(LoopUnrollingAnalyzerTest, TypedArrayKernelLoop) {
+  FlagScope<bool> unroll_typed_array_loops(
+      &v8_flags.turboshaft_unroll_typed_array_loops, true);
+  auto test = CreateFromGraph(
+      1, [](auto& Asm) { EmitTypedArrayLoop(Asm, /* raw_accesses */ true); });
+
+  LoopUnrollingAnalyzer analyzer(test.zone(), &test.graph(), false);
+  const Block& loop = GetFirstLoop(test.graph());
+  EXPECT_TRUE(analyzer.IsTypedArrayKernelLoop(&loop));
+  ASSERT_TRUE(analyzer.ShouldPartiallyUnrollLoop(&loop));
+  EXPECT_EQ(LoopUnrollingAnalyzer::kTypedArrayKernelPartialUnrollingCount,
+            analyzer.GetPartialUnrollingCount(&loop));
+
+  // Wasm loops are never treated as typed array kernels.
+  LoopUnrollingAnalyzer wasm_analyzer(test.zone(), &test.graph(), true);
+  EXPECT_FALSE(wasm_analyzer.IsTypedArrayKernelLoop(&loop));
+}
+
+// Checking that the LoopUnrollingReducer actually emits
+// kTypedArrayKernelPartialUnrollingCount copies of the body of a typed array
+// kernel.
+TEST_F(LoopUnrollingAnalyzerTest, TypedArrayKernelLoopUnrollCount) {
+  FlagScope<bool> unroll_typed_array_loops(
+      &v8_flags.turboshaft_unroll_typed_array_loops, true);
+  auto test = CreateFromGraph(
+      1, [](auto& Asm) { EmitTypedArrayLoop(Asm, /* raw_accesses */ true); });
+  ASSERT_EQ(1u, test.CountOp(Opcode::kStore));
+
+  LoopUnrollingAnalyzer analyzer(test.zone(), &test.graph(), false);
+  ASSERT_TRUE(analyzer.ShouldPartiallyUnrollLoop(&GetFirstLoop(test.graph())));
+  test.graph().set_loop_unrolling_analyzer(&analyzer);
+  test.Run<LoopUnrollingReducer>();
+
+  EXPECT_EQ(1u, CountLoops(test.graph()));
+  EXPECT_EQ(LoopUnrollingAnalyzer::kTypedArrayKernelPartialUnrollingCount,
+            test.CountOp(Opcode::kStore));
+  // The stack checks of all but the last unrolled iteration are removed.
+  EXPECT_EQ(1u, test.CountOp(Opcode::kJSStackCheck));
+}
+
+TEST_F(LoopUnrollingAnalyzerTest, TaggedAccessLoopIsNotTypedArrayKernel) {
+  FlagScope<bool> unroll_typed_array_loops(
+      &v8_flags.turboshaft_unroll_typed_array_loops, true);
+  auto test = CreateFromGraph(
+      1, [](auto& Asm) { EmitTypedArrayLoop(Asm, /* raw_accesses */ false); });
+
+  LoopUnrollingAnalyzer analyzer(test.zone(), &test.graph(), false);
+  const Block& loop = GetFirstLoop(test.graph());
+  EXPECT_FALSE(analyzer.IsTypedArrayKernelLoop(&loop));
+  if (analyzer.ShouldPartiallyUnrollLoop(&loop)) {
+    EXPECT_EQ(LoopUnrollingAnalyzer::kPartialUnrollingCount,
+              analyzer.GetPartialUnrollingCount(&loop));
+  }
+}
+
 #include "src/compiler/turboshaft/undef-assembler-macros.inc"
 
 }  // namespace v8::internal::compiler::turboshaft
@@ -6,6 +6,7 @@
 
 #include "src/base/platform/platform.h"
 #include "src/objects/backing-store.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -133,5 +134,30 @@ TEST_F(BackingStoreTest, RacyGrowWasmMemoryInPlace) {
   }
 }
 
+TEST_F(BackingStoreTest, ReusePooledWasmMemory) {
+  FLAG_VALUE_SCOPE(wasm_memory_pool_size, 1);
+  void* buffer_start;
+  {
+    auto backing_store = BackingStore::AllocateWasmMemory(
+        isolate(), 1, 2, WasmMemoryFlag::kWasmMemory32, SharedFlag::kNotShared);
+    CHECK(backing_store);
+    buffer_start = backing_store->buffer_start();
+    memset(buffer_start, 0xab, wasm::kWasmPageSize);
+  }
+
+  // The reservation is reused, and its memory is zeroed again.
+  auto backing_store = BackingStore::AllocateWasmMemory(
+      isolate(), 2, 2, WasmMemoryFlag::kWasmMemory32, SharedFlag::kNotShared);
+  CHECK(backing_store);
+  EXPECT_EQ(buffer_start, backing_store->buffer_start());
+  const uint8_t* bytes =
+      reinterpret_cast<const uint8_t*>(backing_store->buffer_start());
+  for (size_t i = 0; i < 2 * wasm::kWasmPageSize; ++i) {
+    ASSERT_EQ(0, bytes[i]);
+  }
+  backing_store.reset();
+  BackingStore::FlushWasmMemoryPool();
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -0,0 +1,79 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/flags/flags.h"
+#include "src/wasm/stacks.h"
+#include "test/common/flag-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8::internal::wasm {
+
+class StackPoolTest : public ::testing::Test {};
+
+TEST_F(StackPoolTest, ReuseFinishedStack) {
+  StackPool pool;
+  std::unique_ptr<StackMemory> stack = pool.GetOrAllocate();
+  StackMemory* raw_stack = stack.get();
+  size_t stack_size = stack->allocated_size();
+  pool.Add(std::move(stack));
+  EXPECT_EQ(1u, pool.pooled_stacks());
+  EXPECT_LE(stack_size, pool.Size());
+
+  stack = pool.GetOrAllocate();
+  EXPECT_EQ(raw_stack, stack.get());
+  EXPECT_EQ(0u, pool.pooled_stacks());
+  EXPECT_EQ(1u, pool.stats().allocated_stacks);
+  EXPECT_EQ(1u, pool.stats().reused_stacks);
+}
+
+TEST_F(StackPoolTest, GrowableStacksStartSmall) {
+  FLAG_VALUE_SCOPE(experimental_wasm_growable_stacks, true);
+  FLAG_VALUE_SCOPE(wasm_growable_stack_initial_size, 16);
+  StackPool pool;
+  std::unique_ptr<StackMemory> stack = pool.GetOrAllocate();
+  size_t initial_size = stack->allocated_size();
+  EXPECT_GE(initial_size, (16 + StackMemory::kJSLimitOffsetKB) * KB);
+  size_t default_size =
+      static_cast<size_t>(v8_flags.wasm_stack_switching_stack_size) * KB;
+  EXPECT_LT(initial_size, default_size);
+
+  // Grown segments are kept in the pool and reused by the next computation.
+  ASSERT_TRUE(stack->Grow(0));
+  size_t grown_size = stack->allocated_size();
+  EXPECT_LT(initial_size, grown_size);
+  pool.Add(std::move(stack));
+  stack = pool.GetOrAllocate();
+  EXPECT_EQ(grown_size, stack->allocated_size());
+  ASSERT_TRUE(stack->Grow(0));
+  EXPECT_EQ(grown_size, stack->allocated_size());
+  EXPECT_EQ(0u, pool.Size());
+}
+
+TEST_F(StackPoolTest, PoolSizeLimit) {
+  FLAG_VALUE_SCOPE(experimental_wasm_growable_stacks, true);
+  StackPool pool;
+  std::unique_ptr<StackMemory> stack1 = pool.GetOrAllocate();
+  std::unique_ptr<StackMemory> stack2 = pool.GetOrAllocate();
+  size_t initial_size = stack1->allocated_size();
+  ASSERT_TRUE(stack2->Grow(0));
+
+  // Room for exactly one unsegmented stack.
+  FLAG_VALUE_SCOPE(wasm_stack_pool_size,
+                   static_cast<unsigned>(initial_size / KB));
+  // The grown segments are freed to make the stack fit.
+  pool.Add(std::move(stack2));
+  EXPECT_EQ(1u, pool.pooled_stacks());
+  EXPECT_EQ(1u, pool.stats().freed_segments);
+  EXPECT_EQ(initial_size, pool.Size() - sizeof(std::unique_ptr<StackMemory>));
+  // There is no room for another stack.
+  pool.Add(std::move(stack1));
+  EXPECT_EQ(1u, pool.pooled_stacks());
+  EXPECT_EQ(1u, pool.stats().freed_stacks);
+
+  pool.ReleaseFinishedStacks();
+  EXPECT_EQ(0u, pool.pooled_stacks());
+  EXPECT_EQ(0u, pool.Size());
+}
+
+}  // namespace v8::internal::wasm
@@ -20,6 +20,8 @@ namespace wasm {
 struct MockStreamingResult {
   size_t num_sections = 0;
   size_t num_functions = 0;
+  // Index of a function body for which processing fails, if any.
+  int failing_function = -1;
   bool error;
   base::OwnedVector<const uint8_t> received_bytes;
 
@@ -73,6 +75,10 @@ class MockStreamingProcessor : public StreamingProcessor {
   // Process a function body.
   bool ProcessFunctionBody(base::Vector<const uint8_t> bytes,
                            uint32_t offset) override {
+    if (static_cast<int>(result_->num_functions) ==
+        result_->failing_function) {
+      return false;
+    }
     ++result_->num_functions;
     return true;
   }
@@ -423,6 +429,91 @@ TEST_F(WasmStreamingDecoderTest, TwoFunctions) {
   ExpectVerifies(base::ArrayVector(data), 0, 2);
 }
 
+TEST_F(WasmStreamingDecoderTest, Progress) {
+  const uint8_t data[] = {
+      U32_LE(kWasmMagic),    // --
+      U32_LE(kWasmVersion),  // --
+      kCodeSectionCode,      // Section ID
+      0x10,                  // Section Length
+      0x2,                   // Number of Functions
+      0x6,                   // Function Length
+      0x0,                   // Function
+      0x0,                   // 2
+      0x0,                   // 3
+      0x0,                   // 4
+      0x0,                   // 5
+      0x0,                   // 6
+      0x7,                   // Function Length
+      0x0,                   // Function
+      0x0,                   // 2
+      0x0,                   // 3
+      0x0,                   // 4
+      0x0,                   // 5
+      0x0,                   // 6
+      0x0,                   // 7
+  };
+  base::Vector<const uint8_t> bytes = base::ArrayVector(data);
+  // Split after the first function body.
+  constexpr int kSplit = 18;
+  MockStreamingResult result;
+  auto stream = StreamingDecoder::CreateAsyncStreamingDecoder(
+      std::make_unique<MockStreamingProcessor>(&result));
+  StreamingProgress progress = stream->GetProgress();
+  EXPECT_EQ(0u, progress.received_bytes);
+  EXPECT_EQ(0, progress.total_functions);
+
+  stream->OnBytesReceived(bytes.SubVector(0, kSplit));
+  progress = stream->GetProgress();
+  EXPECT_EQ(size_t{kSplit}, progress.received_bytes);
+  EXPECT_EQ(2, progress.total_functions);
+  EXPECT_EQ(1, progress.received_functions);
+  EXPECT_EQ(0, progress.compiled_functions);
+
+  stream->OnBytesReceived(bytes.SubVector(kSplit, bytes.length()));
+  progress = stream->GetProgress();
+  EXPECT_EQ(bytes.size(), progress.received_bytes);
+  EXPECT_EQ(2, progress.received_functions);
+  stream->Finish();
+  EXPECT_TRUE(result.ok());
+}
+
+TEST_F(WasmStreamingDecoderTest, ProgressAfterFailedFunction) {
+  const uint8_t data[] = {
+      U32_LE(kWasmMagic),    // --
+      U32_LE(kWasmVersion),  // --
+      kCodeSectionCode,      // Section ID
+      0x10,                  // Section Length
+      0x2,                   // Number of Functions
+      0x6,                   // Function Length
+      0x0,                   // Function
+      0x0,                   // 2
+      0x0,                   // 3
+      0x0,                   // 4
+      0x0,                   // 5
+      0x0,                   // 6
+      0x7,                   // Function Length
+      0x0,                   // Function
+      0x0,                   // 2
+      0x0,                   // 3
+      0x0,                   // 4
+      0x0,                   // 5
+      0x0,                   // 6
+      0x0,                   // 7
+  };
+  MockStreamingResult result;
+  result.failing_function = 1;
+  auto stream = StreamingDecoder::CreateAsyncStreamingDecoder(
+      std::make_unique<MockStreamingProcessor>(&result));
+  stream->OnBytesReceived(base::ArrayVector(data));
+  // Only the function that was processed successfully counts as received.
+  StreamingProgress progress = stream->GetProgress();
+  EXPECT_EQ(2, progress.total_functions);
+  EXPECT_EQ(1, progress.received_functions);
+  stream->Finish();
+  EXPECT_FALSE(result.ok());
+  EXPECT_EQ(1u, result.num_functions);
+}
+
 TEST_F(WasmStreamingDecoderTest, TwoFunctions_b) {
   const uint8_t data[] = {
       U32_LE(kWasmMagic),    // --